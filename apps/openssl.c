@@ -298,6 +298,11 @@ int main(int argc, char *argv[])
     arg.argv = NULL;
     arg.size = 0;
 
+    /* This must come before anything is allocated */
+    p = getenv("OPENSSL_MEM_CACHE");
+    if (p != NULL && strcmp(p, "on") == 0)
+        CRYPTO_set_mem_cache(1);
+
     /* Set up some of the environment. */
     default_config_file = make_config_name();
     bio_in = dup_bio_in(FORMAT_TEXT);
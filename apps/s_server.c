@@ -266,6 +266,7 @@ static int dtlslisten = 0;
 
 static BIO *serverinfo_in = NULL;
 static const char *s_serverinfo_file = NULL;
+static const char *s_status_file = NULL;
 
 #ifndef OPENSSL_NO_PSK
 static char *psk_identity = "Client_identity";
@@ -802,9 +803,9 @@ typedef enum OPTION_choice {
     OPT_BUILD_CHAIN, OPT_CAFILE, OPT_NOCAFILE, OPT_CHAINCAFILE,
     OPT_VERIFYCAFILE, OPT_NBIO, OPT_NBIO_TEST, OPT_IGN_EOF, OPT_NO_IGN_EOF,
     OPT_DEBUG, OPT_TLSEXTDEBUG, OPT_STATUS, OPT_STATUS_VERBOSE,
-    OPT_STATUS_TIMEOUT, OPT_STATUS_URL, OPT_MSG, OPT_MSGFILE, OPT_TRACE,
-    OPT_SECURITY_DEBUG, OPT_SECURITY_DEBUG_VERBOSE, OPT_STATE, OPT_CRLF,
-    OPT_QUIET, OPT_BRIEF, OPT_NO_DHE,
+    OPT_STATUS_TIMEOUT, OPT_STATUS_URL, OPT_STATUS_FILE, OPT_MSG, OPT_MSGFILE,
+    OPT_TRACE, OPT_SECURITY_DEBUG, OPT_SECURITY_DEBUG_VERBOSE, OPT_STATE,
+    OPT_CRLF, OPT_QUIET, OPT_BRIEF, OPT_NO_DHE,
     OPT_NO_RESUME_EPHEMERAL, OPT_PSK_HINT, OPT_PSK, OPT_SRPVFILE,
     OPT_SRPUSERSEED, OPT_REV, OPT_WWW, OPT_UPPER_WWW, OPT_HTTP, OPT_ASYNC,
     OPT_SSL_CONFIG, OPT_SSL3,
@@ -906,6 +907,8 @@ OPTIONS s_server_options[] = {
     {"status_verbose", OPT_STATUS_VERBOSE, '-'},
     {"status_timeout", OPT_STATUS_TIMEOUT, 'n'},
     {"status_url", OPT_STATUS_URL, 's'},
+    {"status_file", OPT_STATUS_FILE, '<',
+     "File containing DER encoded OCSP response to staple"},
     {"trace", OPT_TRACE, '-'},
     {"security_debug", OPT_SECURITY_DEBUG, '-'},
     {"security_debug_verbose", OPT_SECURITY_DEBUG_VERBOSE, '-'},
@@ -1258,6 +1261,9 @@ int s_server_main(int argc, char *argv[])
                 goto end;
             }
             break;
+        case OPT_STATUS_FILE:
+            s_status_file = opt_arg();
+            break;
         case OPT_MSG:
             s_msg = 1;
             break;
@@ -1831,6 +1837,25 @@ int s_server_main(int argc, char *argv[])
             goto end;
     }
 
+    if (s_status_file != NULL) {
+        BIO *in = BIO_new_file(s_status_file, "rb");
+        unsigned char *rspder = NULL;
+        int rspderlen = -1;
+
+        if (in != NULL)
+            rspderlen = bio_to_mem(&rspder, 0xfffff0, in);
+        BIO_free(in);
+        if (rspderlen <= 0
+            || !SSL_CTX_set1_ocsp_staple(ctx, s_cert, rspder, rspderlen)) {
+            BIO_printf(bio_err, "Error loading OCSP response from %s\n",
+                       s_status_file);
+            ERR_print_errors(bio_err);
+            OPENSSL_free(rspder);
+            goto end;
+        }
+        OPENSSL_free(rspder);
+    }
+
     if (no_resume_ephemeral) {
         SSL_CTX_set_not_resumable_session_callback(ctx,
                                                    not_resumable_sess_cb);
@@ -96,16 +96,18 @@ int asn1_set_choice_selector(ASN1_VALUE **pval, int value,
 }
 
 /*
- * Do reference counting. The value 'op' decides what to do. if it is +1
- * then the count is incremented. If op is 0 count is set to 1. If op is -1
- * count is decremented and the return value is the current reference count
- * or 0 if no reference count exists.
+ * Do reference counting. The value 'op' decides what to do. If it is +1
+ * then the count is incremented. If op is 0 count is set to 1 and the
+ * object's lock is created. If op is -1 count is decremented and the lock
+ * freed when it reaches zero. The return value is the current reference
+ * count, 0 if no reference count exists or -1 on error.
  */
 
 int asn1_do_lock(ASN1_VALUE **pval, int op, const ASN1_ITEM *it)
 {
     const ASN1_AUX *aux;
     int *lck, ret;
+    CRYPTO_RWLOCK **lock;
     if ((it->itype != ASN1_ITYPE_SEQUENCE)
         && (it->itype != ASN1_ITYPE_NDEF_SEQUENCE))
         return 0;
@@ -113,11 +115,22 @@ int asn1_do_lock(ASN1_VALUE **pval, int op, const ASN1_ITEM *it)
     if (!aux || !(aux->flags & ASN1_AFLG_REFCOUNT))
         return 0;
     lck = offset2ptr(*pval, aux->ref_offset);
+    lock = offset2ptr(*pval, aux->ref_lock);
     if (op == 0) {
         *lck = 1;
+        *lock = CRYPTO_THREAD_lock_new();
+        if (*lock == NULL) {
+            ASN1err(ASN1_F_ASN1_DO_LOCK, ERR_R_MALLOC_FAILURE);
+            return -1;
+        }
         return 1;
     }
-    ret = CRYPTO_add(lck, op, aux->ref_lock);
+    if (!CRYPTO_atomic_add(lck, op, &ret, *lock))
+        return -1;
+    if (ret == 0) {
+        CRYPTO_THREAD_lock_free(*lock);
+        *lock = NULL;
+    }
 #ifdef REF_PRINT
     fprintf(stderr, "%s: Reference Count: %d\n", it->sname, *lck);
 #endif
@@ -61,16 +61,30 @@
 
 pthread_key_t posixctx;
 pthread_key_t posixpool;
+/*
+ * Until the keys are created posixctx and posixpool are 0, which may well be
+ * a key that somebody else is using.
+ */
+int async_posix_keys_ok = 0;
+static CRYPTO_ONCE posixonce = CRYPTO_ONCE_STATIC_INIT;
 
 #define STACKSIZE       32768
 
-int async_global_init(void)
+static void async_posix_keys_init(void)
 {
-    if (pthread_key_create(&posixctx, NULL) != 0
-            || pthread_key_create(&posixpool, NULL) != 0)
-        return 0;
+    if (pthread_key_create(&posixctx, NULL) != 0)
+        return;
+    if (pthread_key_create(&posixpool, NULL) != 0) {
+        pthread_key_delete(posixctx);
+        return;
+    }
+    async_posix_keys_ok = 1;
+}
 
-    return 1;
+int async_global_init(void)
+{
+    return CRYPTO_THREAD_run_once(&posixonce, async_posix_keys_init)
+           && async_posix_keys_ok;
 }
 
 int async_local_init(void)
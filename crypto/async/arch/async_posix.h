@@ -71,6 +71,7 @@
 
 extern pthread_key_t posixctx;
 extern pthread_key_t posixpool;
+extern int async_posix_keys_ok;
 
 typedef struct async_fibre_st {
     ucontext_t fibre;
@@ -78,10 +79,14 @@ typedef struct async_fibre_st {
     int env_init;
 } async_fibre;
 
-#  define async_set_ctx(nctx)  (pthread_setspecific(posixctx , (nctx)) == 0)
-#  define async_get_ctx()      ((async_ctx *)pthread_getspecific(posixctx))
-#  define async_set_pool(p)    (pthread_setspecific(posixpool , (p)) == 0)
-#  define async_get_pool()     ((async_pool *)pthread_getspecific(posixpool))
+#  define async_set_ctx(nctx) \
+        (async_posix_keys_ok && pthread_setspecific(posixctx, (nctx)) == 0)
+#  define async_get_ctx() \
+        (async_posix_keys_ok ? (async_ctx *)pthread_getspecific(posixctx) : NULL)
+#  define async_set_pool(p) \
+        (async_posix_keys_ok && pthread_setspecific(posixpool, (p)) == 0)
+#  define async_get_pool() \
+        (async_posix_keys_ok ? (async_pool *)pthread_getspecific(posixpool) : NULL)
 
 static inline int async_fibre_swapcontext(async_fibre *o, async_fibre *n, int r)
 {
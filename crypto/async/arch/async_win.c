@@ -68,12 +68,16 @@ struct winpool {
 static DWORD asyncwinpool = 0;
 static DWORD asyncwinctx = 0;
 static DWORD asyncwindispatch = 0;
+/* The indexes above may belong to somebody else until this is set */
+static int asyncwininit = 0;
 
 
 void async_start_func(void);
 
 int async_global_init(void)
 {
+    if (asyncwininit)
+        return 1;
     asyncwinpool = TlsAlloc();
     asyncwinctx = TlsAlloc();
     asyncwindispatch = TlsAlloc();
@@ -90,12 +94,14 @@ int async_global_init(void)
         }
         return 0;
     }
+    asyncwininit = 1;
     return 1;
 }
 
 int async_local_init(void)
 {
-    return (TlsSetValue(asyncwinpool, NULL) != 0)
+    return asyncwininit
+        && (TlsSetValue(asyncwinpool, NULL) != 0)
         && (TlsSetValue(asyncwinctx, NULL) != 0)
         && (TlsSetValue(asyncwindispatch, NULL) != 0);
 }
@@ -114,6 +120,9 @@ void async_local_cleanup(void)
 
 void async_global_cleanup(void)
 {
+    if (!asyncwininit)
+        return;
+    asyncwininit = 0;
     TlsFree(asyncwinpool);
     TlsFree(asyncwinctx);
     TlsFree(asyncwindispatch);
@@ -188,23 +197,27 @@ int async_read1(OSSL_ASYNC_FD fd, void *buf)
 
 async_pool *async_get_pool(void)
 {
+    if (!asyncwininit)
+        return NULL;
     return (async_pool *)TlsGetValue(asyncwinpool);
 }
 
 
 int async_set_pool(async_pool *pool)
 {
-    return TlsSetValue(asyncwinpool, (LPVOID)pool) != 0;
+    return asyncwininit && TlsSetValue(asyncwinpool, (LPVOID)pool) != 0;
 }
 
 async_ctx *async_get_ctx(void)
 {
+    if (!asyncwininit)
+        return NULL;
     return (async_ctx *)TlsGetValue(asyncwinctx);
 }
 
 int async_set_ctx(async_ctx *ctx)
 {
-    return TlsSetValue(asyncwinctx, (LPVOID)ctx) != 0;
+    return asyncwininit && TlsSetValue(asyncwinctx, (LPVOID)ctx) != 0;
 }
 
 #endif
@@ -60,6 +60,7 @@
 #include <errno.h>
 #define USE_SOCKETS
 #include "internal/cryptlib.h"
+#include "internal/ktls.h"
 
 #ifndef OPENSSL_NO_SOCK
 
@@ -137,7 +138,12 @@ static int sock_read(BIO *b, char *out, int outl)
 
     if (out != NULL) {
         clear_socket_error();
-        ret = readsocket(b->num, out, outl);
+# ifndef OPENSSL_NO_KTLS
+        if (BIO_test_flags(b, BIO_FLAGS_KTLS_RX))
+            ret = ktls_read_record(b->num, out, outl);
+        else
+# endif
+            ret = readsocket(b->num, out, outl);
         BIO_clear_retry_flags(b);
         if (ret <= 0) {
             if (BIO_sock_should_retry(ret))
@@ -152,7 +158,16 @@ static int sock_write(BIO *b, const char *in, int inl)
     int ret;
 
     clear_socket_error();
-    ret = writesocket(b->num, in, inl);
+# ifndef OPENSSL_NO_KTLS
+    if (BIO_test_flags(b, BIO_FLAGS_KTLS_TX_CTRL_MSG)) {
+        ret = ktls_send_ctrl_message(b->num, (unsigned char)(size_t)b->ptr,
+                                     in, inl);
+        /* What is left of a partly sent record goes out with the same type */
+        if (ret == inl)
+            BIO_clear_flags(b, BIO_FLAGS_KTLS_TX_CTRL_MSG);
+    } else
+# endif
+        ret = writesocket(b->num, in, inl);
     BIO_clear_retry_flags(b);
     if (ret <= 0) {
         if (BIO_sock_should_retry(ret))
@@ -172,6 +187,8 @@ static long sock_ctrl(BIO *b, int cmd, long num, void *ptr)
         b->num = *((int *)ptr);
         b->shutdown = (int)num;
         b->init = 1;
+        BIO_clear_flags(b, BIO_FLAGS_KTLS_TX | BIO_FLAGS_KTLS_TX_CTRL_MSG
+                           | BIO_FLAGS_KTLS_RX);
         break;
     case BIO_C_GET_FD:
         if (b->init) {
@@ -192,6 +209,34 @@ static long sock_ctrl(BIO *b, int cmd, long num, void *ptr)
     case BIO_CTRL_FLUSH:
         ret = 1;
         break;
+# ifndef OPENSSL_NO_KTLS
+    case BIO_CTRL_SET_KTLS:
+        /*
+         * If the kernel takes the "tls" protocol but not the keys, the
+         * socket just carries on as before
+         */
+        if (BIO_test_flags(b, num ? BIO_FLAGS_KTLS_TX : BIO_FLAGS_KTLS_RX)
+                || !ktls_enable(b->num)
+                || !ktls_start(b->num, (const KTLS_CRYPTO_INFO *)ptr, num))
+            ret = 0;
+        else
+            BIO_set_flags(b, num ? BIO_FLAGS_KTLS_TX : BIO_FLAGS_KTLS_RX);
+        break;
+    case BIO_CTRL_GET_KTLS_SEND:
+        ret = BIO_test_flags(b, BIO_FLAGS_KTLS_TX) != 0;
+        break;
+    case BIO_CTRL_GET_KTLS_RECV:
+        ret = BIO_test_flags(b, BIO_FLAGS_KTLS_RX) != 0;
+        break;
+    case BIO_CTRL_SET_KTLS_TX_SEND_CTRL_MSG:
+        if (!BIO_test_flags(b, BIO_FLAGS_KTLS_TX)) {
+            ret = 0;
+            break;
+        }
+        b->ptr = (void *)(size_t)num;
+        BIO_set_flags(b, BIO_FLAGS_KTLS_TX_CTRL_MSG);
+        break;
+# endif
     default:
         ret = 0;
         break;
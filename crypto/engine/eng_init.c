@@ -62,6 +62,7 @@
 int engine_unlocked_init(ENGINE *e)
 {
     int to_return = 1;
+    int ref;
 
     if ((e->funct_ref == 0) && e->init)
         /*
@@ -74,7 +75,7 @@ int engine_unlocked_init(ENGINE *e)
          * OK, we return a functional reference which is also a structural
          * reference.
          */
-        e->struct_ref++;
+        CRYPTO_atomic_add(&e->struct_ref, 1, &ref, e->lock);
         e->funct_ref++;
         engine_ref_debug(e, 0, 1)
             engine_ref_debug(e, 1, 1)
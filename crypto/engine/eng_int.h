@@ -201,6 +201,8 @@ struct engine_st {
     int flags;
     /* reference count on the structure itself */
     int struct_ref;
+    /* only taken by CRYPTO_atomic_add() where there are no atomics */
+    CRYPTO_RWLOCK *lock;
     /*
      * reference count on usability of the engine type. NB: This controls the
      * loading and initialisation of any functionlity required by this
@@ -71,6 +71,12 @@ ENGINE *ENGINE_new(void)
         ENGINEerr(ENGINE_F_ENGINE_NEW, ERR_R_MALLOC_FAILURE);
         return NULL;
     }
+    ret->lock = CRYPTO_THREAD_lock_new();
+    if (ret->lock == NULL) {
+        ENGINEerr(ENGINE_F_ENGINE_NEW, ERR_R_MALLOC_FAILURE);
+        OPENSSL_free(ret);
+        return NULL;
+    }
     ret->struct_ref = 1;
     engine_ref_debug(ret, 0, 1)
         CRYPTO_new_ex_data(CRYPTO_EX_INDEX_ENGINE, ret, &ret->ex_data);
@@ -109,10 +115,7 @@ int engine_free_util(ENGINE *e, int locked)
 
     if (e == NULL)
         return 1;
-    if (locked)
-        i = CRYPTO_add(&e->struct_ref, -1, CRYPTO_LOCK_ENGINE);
-    else
-        i = --e->struct_ref;
+    CRYPTO_atomic_add(&e->struct_ref, -1, &i, e->lock);
     engine_ref_debug(e, 0, -1)
     if (i > 0)
         return 1;
@@ -132,6 +135,7 @@ int engine_free_util(ENGINE *e, int locked)
     if (e->destroy)
         e->destroy(e);
     CRYPTO_free_ex_data(CRYPTO_EX_INDEX_ENGINE, e, &e->ex_data);
+    CRYPTO_THREAD_lock_free(e->lock);
     OPENSSL_free(e);
     return 1;
 }
@@ -101,7 +101,7 @@ static void engine_list_cleanup(void)
  */
 static int engine_list_add(ENGINE *e)
 {
-    int conflict = 0;
+    int conflict = 0, ref;
     ENGINE *iterator = NULL;
 
     if (e == NULL) {
@@ -141,7 +141,7 @@ static int engine_list_add(ENGINE *e)
     /*
      * Having the engine in the list assumes a structural reference.
      */
-    e->struct_ref++;
+    CRYPTO_atomic_add(&e->struct_ref, 1, &ref, e->lock);
     engine_ref_debug(e, 0, 1)
         /* However it came to be, e is the last item in the list. */
         engine_list_tail = e;
@@ -184,11 +184,12 @@ static int engine_list_remove(ENGINE *e)
 ENGINE *ENGINE_get_first(void)
 {
     ENGINE *ret;
+    int ref;
 
     CRYPTO_w_lock(CRYPTO_LOCK_ENGINE);
     ret = engine_list_head;
     if (ret) {
-        ret->struct_ref++;
+        CRYPTO_atomic_add(&ret->struct_ref, 1, &ref, ret->lock);
         engine_ref_debug(ret, 0, 1)
     }
     CRYPTO_w_unlock(CRYPTO_LOCK_ENGINE);
@@ -198,11 +199,12 @@ ENGINE *ENGINE_get_first(void)
 ENGINE *ENGINE_get_last(void)
 {
     ENGINE *ret;
+    int ref;
 
     CRYPTO_w_lock(CRYPTO_LOCK_ENGINE);
     ret = engine_list_tail;
     if (ret) {
-        ret->struct_ref++;
+        CRYPTO_atomic_add(&ret->struct_ref, 1, &ref, ret->lock);
         engine_ref_debug(ret, 0, 1)
     }
     CRYPTO_w_unlock(CRYPTO_LOCK_ENGINE);
@@ -213,6 +215,8 @@ ENGINE *ENGINE_get_last(void)
 ENGINE *ENGINE_get_next(ENGINE *e)
 {
     ENGINE *ret = NULL;
+    int ref;
+
     if (e == NULL) {
         ENGINEerr(ENGINE_F_ENGINE_GET_NEXT, ERR_R_PASSED_NULL_PARAMETER);
         return 0;
@@ -221,7 +225,7 @@ ENGINE *ENGINE_get_next(ENGINE *e)
     ret = e->next;
     if (ret) {
         /* Return a valid structural refernce to the next ENGINE */
-        ret->struct_ref++;
+        CRYPTO_atomic_add(&ret->struct_ref, 1, &ref, ret->lock);
         engine_ref_debug(ret, 0, 1)
     }
     CRYPTO_w_unlock(CRYPTO_LOCK_ENGINE);
@@ -233,6 +237,8 @@ ENGINE *ENGINE_get_next(ENGINE *e)
 ENGINE *ENGINE_get_prev(ENGINE *e)
 {
     ENGINE *ret = NULL;
+    int ref;
+
     if (e == NULL) {
         ENGINEerr(ENGINE_F_ENGINE_GET_PREV, ERR_R_PASSED_NULL_PARAMETER);
         return 0;
@@ -241,7 +247,7 @@ ENGINE *ENGINE_get_prev(ENGINE *e)
     ret = e->prev;
     if (ret) {
         /* Return a valid structural reference to the next ENGINE */
-        ret->struct_ref++;
+        CRYPTO_atomic_add(&ret->struct_ref, 1, &ref, ret->lock);
         engine_ref_debug(ret, 0, 1)
     }
     CRYPTO_w_unlock(CRYPTO_LOCK_ENGINE);
@@ -323,6 +329,8 @@ ENGINE *ENGINE_by_id(const char *id)
 {
     ENGINE *iterator;
     char *load_dir = NULL;
+    int ref;
+
     if (id == NULL) {
         ENGINEerr(ENGINE_F_ENGINE_BY_ID, ERR_R_PASSED_NULL_PARAMETER);
         return NULL;
@@ -346,7 +354,7 @@ ENGINE *ENGINE_by_id(const char *id)
                 iterator = cp;
             }
         } else {
-            iterator->struct_ref++;
+            CRYPTO_atomic_add(&iterator->struct_ref, 1, &ref, iterator->lock);
             engine_ref_debug(iterator, 0, 1)
         }
     }
@@ -384,10 +392,12 @@ ENGINE *ENGINE_by_id(const char *id)
 
 int ENGINE_up_ref(ENGINE *e)
 {
+    int i;
+
     if (e == NULL) {
         ENGINEerr(ENGINE_F_ENGINE_UP_REF, ERR_R_PASSED_NULL_PARAMETER);
         return 0;
     }
-    CRYPTO_add(&e->struct_ref, 1, CRYPTO_LOCK_ENGINE);
+    CRYPTO_atomic_add(&e->struct_ref, 1, &i, e->lock);
     return 1;
 }
@@ -229,6 +229,8 @@ const EVP_PKEY_ASN1_METHOD *ENGINE_pkey_asn1_find_str(ENGINE **pe,
                                                       int len)
 {
     ENGINE_FIND_STR fstr;
+    int ref;
+
     fstr.e = NULL;
     fstr.ameth = NULL;
     fstr.str = str;
@@ -237,7 +239,7 @@ const EVP_PKEY_ASN1_METHOD *ENGINE_pkey_asn1_find_str(ENGINE **pe,
     engine_table_doall(pkey_asn1_meth_table, look_str_cb, &fstr);
     /* If found obtain a structural reference to engine */
     if (fstr.e) {
-        fstr.e->struct_ref++;
+        CRYPTO_atomic_add(&fstr.e->struct_ref, 1, &ref, fstr.e->lock);
         engine_ref_debug(fstr.e, 0, 1)
     }
     *pe = fstr.e;
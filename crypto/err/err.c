@@ -240,6 +240,20 @@ static LHASH_OF(ERR_STATE) *int_thread_hash = NULL;
 static int int_thread_hash_references = 0;
 static int int_err_library_number = ERR_LIB_USER;
 
+/*
+ * Each thread caches a pointer to its ERR_STATE in thread-local storage so
+ * that ERR_get_state() normally takes no lock; int_thread_hash remains the
+ * registry used to find and free the states.
+ */
+static CRYPTO_ONCE err_once = CRYPTO_ONCE_STATIC_INIT;
+static CRYPTO_THREAD_LOCAL err_thread_local;
+static int err_thread_local_ok = 0;
+/*
+ * Set once the state of another thread has been removed: that thread's
+ * cached pointer may be stale, so all lookups go through the registry.
+ */
+static volatile int err_thread_local_stale = 0;
+
 static unsigned long get_error_values(int inc, int top, const char **file,
                                       int *line, const char **data,
                                       int *flags);
@@ -833,14 +847,39 @@ const char *ERR_reason_error_string(unsigned long e)
     return ((p == NULL) ? NULL : p->string);
 }
 
+/* Thread exit handler: free the state of the exiting thread */
+static void err_thread_stop(void *arg)
+{
+    ERR_STATE tmp;
+
+    CRYPTO_THREADID_current(&tmp.tid);
+    int_thread_del_item(&tmp);
+}
+
+static void err_do_init(void)
+{
+    err_thread_local_ok = CRYPTO_THREAD_init_local(&err_thread_local,
+                                                   err_thread_stop);
+}
+
+static int err_thread_local_init(void)
+{
+    return CRYPTO_THREAD_run_once(&err_once, err_do_init)
+           && err_thread_local_ok;
+}
+
 void ERR_remove_thread_state(const CRYPTO_THREADID *id)
 {
     ERR_STATE tmp;
 
-    if (id)
+    CRYPTO_THREADID_current(&tmp.tid);
+    if (id == NULL || CRYPTO_THREADID_cmp(id, &tmp.tid) == 0) {
+        if (err_thread_local_init())
+            CRYPTO_THREAD_set_local(&err_thread_local, NULL);
+    } else {
         CRYPTO_THREADID_cpy(&tmp.tid, id);
-    else
-        CRYPTO_THREADID_current(&tmp.tid);
+        err_thread_local_stale = 1;
+    }
     /*
      * thread_del_item automatically destroys the LHASH if the number of
      * items reaches zero.
@@ -859,9 +898,14 @@ ERR_STATE *ERR_get_state(void)
 {
     static ERR_STATE fallback;
     ERR_STATE *ret, tmp, *tmpp = NULL;
-    int i;
+    int i, local;
     CRYPTO_THREADID tid;
 
+    local = err_thread_local_init();
+    if (local && !err_thread_local_stale
+        && (ret = CRYPTO_THREAD_get_local(&err_thread_local)) != NULL)
+        return ret;
+
     CRYPTO_THREADID_current(&tid);
     CRYPTO_THREADID_cpy(&tmp.tid, &tid);
     ret = int_thread_get_item(&tmp);
@@ -890,6 +934,8 @@ ERR_STATE *ERR_get_state(void)
          */
         ERR_STATE_free(tmpp);
     }
+    if (local)
+        CRYPTO_THREAD_set_local(&err_thread_local, ret);
     return ret;
 }
 
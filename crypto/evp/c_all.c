@@ -78,4 +78,5 @@ void OPENSSL_add_all_algorithms_noconf(void)
     ENGINE_setup_bsd_cryptodev();
 # endif
 #endif
+    OBJ_NAME_freeze();
 }
@@ -123,16 +123,42 @@ struct ex_callback_st {
     CRYPTO_EX_dup *dup_func;
 };
 
+/*
+ * A read-only copy of a class's callbacks. CRYPTO_new_ex_data() and friends
+ * run on every SSL, SSL_SESSION, X509, RSA... so they read the current
+ * snapshot without a lock. Registering or freeing an index publishes a new
+ * snapshot; old ones are kept on the |prev| chain until
+ * CRYPTO_cleanup_all_ex_data() as a reader may still be using them.
+ */
+typedef struct ex_snapshot_st {
+    struct ex_snapshot_st *prev;
+    int num;                    /* Number of indexes, including 0 */
+    int ncb;                    /* Number of indexes with any callback */
+    EX_CALLBACK cb[1];
+} EX_SNAPSHOT;
+
 /*
  * The state for each class.  This could just be a typedef, but
  * a structure allows future changes.
  */
 typedef struct ex_callbacks_st {
     STACK_OF(EX_CALLBACK) *meth;
+    EX_SNAPSHOT *snap;
 } EX_CALLBACKS;
 
 static EX_CALLBACKS ex_data[CRYPTO_EX_INDEX__COUNT];
 
+/* What readers see for a class nobody has registered an index in */
+static const EX_SNAPSHOT ex_snapshot_empty = { NULL, 1, 0 };
+
+#if defined(__ATOMIC_ACQUIRE)
+# define ex_snapshot_load(p)     __atomic_load_n(&(p), __ATOMIC_ACQUIRE)
+# define ex_snapshot_store(p, v) __atomic_store_n(&(p), (v), __ATOMIC_RELEASE)
+#else
+# define ex_snapshot_load(p)     (*(EX_SNAPSHOT *volatile *)&(p))
+# define ex_snapshot_store(p, v) (*(EX_SNAPSHOT *volatile *)&(p) = (v))
+#endif
+
 /*
  * Return the EX_CALLBACKS from the |ex_data| array that corresponds to
  * a given class.  On success, *holds the lock.*
@@ -167,6 +193,48 @@ static void cleanup_cb(EX_CALLBACK *funcs)
     OPENSSL_free(funcs);
 }
 
+/*
+ * Rebuild the snapshot of |ip| from its stack and publish it. Called with
+ * CRYPTO_LOCK_EX_DATA held.
+ */
+static int publish_snapshot(EX_CALLBACKS *ip)
+{
+    EX_SNAPSHOT *snap;
+    EX_CALLBACK *a;
+    int i, num = sk_EX_CALLBACK_num(ip->meth);
+
+    snap = OPENSSL_zalloc(sizeof(*snap) + sizeof(snap->cb[0]) * (num - 1));
+    if (snap == NULL)
+        return 0;
+    snap->num = num;
+    for (i = 0; i < num; i++) {
+        if ((a = sk_EX_CALLBACK_value(ip->meth, i)) == NULL)
+            continue;
+        snap->cb[i] = *a;
+        if (a->new_func != NULL || a->free_func != NULL
+            || a->dup_func != NULL)
+            snap->ncb++;
+    }
+    snap->prev = ip->snap;
+    ex_snapshot_store(ip->snap, snap);
+    return 1;
+}
+
+/*
+ * Return the current snapshot for a class, without locking.
+ */
+static const EX_SNAPSHOT *get_snapshot(int class_index)
+{
+    const EX_SNAPSHOT *snap;
+
+    if (class_index < 0 || class_index >= CRYPTO_EX_INDEX__COUNT) {
+        CRYPTOerr(CRYPTO_F_GET_SNAPSHOT, CRYPTO_R_BAD_EX_DATA_CLASS);
+        return NULL;
+    }
+    snap = ex_snapshot_load(ex_data[class_index].snap);
+    return snap != NULL ? snap : &ex_snapshot_empty;
+}
+
 /*
  * Release all "ex_data" state to prevent memory leaks. This can't be made
  * thread-safe without overhauling a lot of stuff, and shouldn't really be
@@ -179,9 +247,14 @@ void CRYPTO_cleanup_all_ex_data(void)
 
     for (i = 0; i < CRYPTO_EX_INDEX__COUNT; ++i) {
         EX_CALLBACKS *ip = &ex_data[i];
+        EX_SNAPSHOT *snap;
 
         sk_EX_CALLBACK_pop_free(ip->meth, cleanup_cb);
         ip->meth = NULL;
+        while ((snap = ip->snap) != NULL) {
+            ip->snap = snap->prev;
+            OPENSSL_free(snap);
+        }
     }
 }
 
@@ -223,6 +296,10 @@ int CRYPTO_free_ex_index(int class_index, int idx)
     a->new_func = dummy_new;
     a->dup_func = dummy_dup;
     a->free_func = dummy_free;
+    if (!publish_snapshot(ip)) {
+        CRYPTOerr(CRYPTO_F_CRYPTO_FREE_EX_INDEX, ERR_R_MALLOC_FAILURE);
+        goto err;
+    }
     toret = 1;
 err:
     CRYPTO_w_unlock(CRYPTO_LOCK_EX_DATA);
@@ -260,6 +337,13 @@ int CRYPTO_get_ex_new_index(int class_index, long argl, void *argp,
     }
     toret = sk_EX_CALLBACK_num(ip->meth) - 1;
     (void)sk_EX_CALLBACK_set(ip->meth, toret, a);
+    if (!publish_snapshot(ip)) {
+        CRYPTOerr(CRYPTO_F_CRYPTO_GET_EX_NEW_INDEX, ERR_R_MALLOC_FAILURE);
+        /* The index is taken but has no callbacks yet: give it none */
+        (void)sk_EX_CALLBACK_set(ip->meth, toret, NULL);
+        OPENSSL_free(a);
+        toret = -1;
+    }
 
  err:
     CRYPTO_w_unlock(CRYPTO_LOCK_EX_DATA);
@@ -269,48 +353,31 @@ int CRYPTO_get_ex_new_index(int class_index, long argl, void *argp,
 /*
  * Initialise a new CRYPTO_EX_DATA for use in a particular class - including
  * calling new() callbacks for each index in the class used by this variable
- * Thread-safe by copying a class's array of "EX_CALLBACK" entries
- * in the lock, then using them outside the lock. Note this only applies
+ * Thread-safe by reading the class's current snapshot of "EX_CALLBACK"
+ * entries, which is never modified once published. Note this only applies
  * to the global "ex_data" state (ie. class definitions), not 'ad' itself.
  */
 int CRYPTO_new_ex_data(int class_index, void *obj, CRYPTO_EX_DATA *ad)
 {
-    int mx, i;
+    int i;
     void *ptr;
-    EX_CALLBACK **storage = NULL;
-    EX_CALLBACK *stack[10];
-    EX_CALLBACKS *ip = get_and_lock(class_index);
+    const EX_CALLBACK *cb;
+    const EX_SNAPSHOT *snap = get_snapshot(class_index);
 
-    if (ip == NULL)
+    if (snap == NULL)
         return 0;
 
     ad->sk = NULL;
 
-    mx = sk_EX_CALLBACK_num(ip->meth);
-    if (mx > 0) {
-        if (mx < (int)OSSL_NELEM(stack))
-            storage = stack;
-        else
-            storage = OPENSSL_malloc(sizeof(*storage) * mx);
-        if (storage != NULL)
-            for (i = 0; i < mx; i++)
-                storage[i] = sk_EX_CALLBACK_value(ip->meth, i);
-    }
-    CRYPTO_w_unlock(CRYPTO_LOCK_EX_DATA);
-
-    if (mx > 0 && storage == NULL) {
-        CRYPTOerr(CRYPTO_F_CRYPTO_NEW_EX_DATA, ERR_R_MALLOC_FAILURE);
-        return 0;
-    }
-    for (i = 0; i < mx; i++) {
-        if (storage[i] && storage[i]->new_func) {
+    if (snap->ncb == 0)
+        return 1;
+    for (i = 0; i < snap->num; i++) {
+        cb = &snap->cb[i];
+        if (cb->new_func) {
             ptr = CRYPTO_get_ex_data(ad, i);
-            storage[i]->new_func(obj, ptr, ad, i,
-                                 storage[i]->argl, storage[i]->argp);
+            cb->new_func(obj, ptr, ad, i, cb->argl, cb->argp);
         }
     }
-    if (storage != stack)
-        OPENSSL_free(storage);
     return 1;
 }
 
@@ -323,45 +390,27 @@ int CRYPTO_dup_ex_data(int class_index, CRYPTO_EX_DATA *to,
 {
     int mx, j, i;
     char *ptr;
-    EX_CALLBACK *stack[10];
-    EX_CALLBACK **storage = NULL;
-    EX_CALLBACKS *ip;
+    const EX_CALLBACK *cb;
+    const EX_SNAPSHOT *snap;
 
     if (from->sk == NULL)
         /* Nothing to copy over */
         return 1;
-    if ((ip = get_and_lock(class_index)) == NULL)
+    if ((snap = get_snapshot(class_index)) == NULL)
         return 0;
 
-    mx = sk_EX_CALLBACK_num(ip->meth);
+    mx = snap->num;
     j = sk_void_num(from->sk);
     if (j < mx)
         mx = j;
-    if (mx > 0) {
-        if (mx < (int)OSSL_NELEM(stack))
-            storage = stack;
-        else
-            storage = OPENSSL_malloc(sizeof(*storage) * mx);
-        if (storage != NULL)
-            for (i = 0; i < mx; i++)
-                storage[i] = sk_EX_CALLBACK_value(ip->meth, i);
-    }
-    CRYPTO_w_unlock(CRYPTO_LOCK_EX_DATA);
-
-    if (mx > 0 && storage == NULL) {
-        CRYPTOerr(CRYPTO_F_CRYPTO_DUP_EX_DATA, ERR_R_MALLOC_FAILURE);
-        return 0;
-    }
 
     for (i = 0; i < mx; i++) {
+        cb = &snap->cb[i];
         ptr = CRYPTO_get_ex_data(from, i);
-        if (storage[i] && storage[i]->dup_func)
-            storage[i]->dup_func(to, from, &ptr, i,
-                                 storage[i]->argl, storage[i]->argp);
+        if (cb->dup_func)
+            cb->dup_func(to, from, &ptr, i, cb->argl, cb->argp);
         CRYPTO_set_ex_data(to, i, ptr);
     }
-    if (storage != stack)
-        OPENSSL_free(storage);
     return 1;
 }
 
@@ -372,41 +421,24 @@ int CRYPTO_dup_ex_data(int class_index, CRYPTO_EX_DATA *to,
  */
 void CRYPTO_free_ex_data(int class_index, void *obj, CRYPTO_EX_DATA *ad)
 {
-    int mx, i;
-    EX_CALLBACKS *ip;
+    int i;
     void *ptr;
-    EX_CALLBACK *stack[10];
-    EX_CALLBACK **storage = NULL;
+    const EX_CALLBACK *cb;
+    const EX_SNAPSHOT *snap;
 
-    if ((ip = get_and_lock(class_index)) == NULL)
+    if ((snap = get_snapshot(class_index)) == NULL)
         return;
 
-    mx = sk_EX_CALLBACK_num(ip->meth);
-    if (mx > 0) {
-        if (mx < (int)OSSL_NELEM(stack))
-            storage = stack;
-        else
-            storage = OPENSSL_malloc(sizeof(*storage) * mx);
-        if (storage != NULL)
-            for (i = 0; i < mx; i++)
-                storage[i] = sk_EX_CALLBACK_value(ip->meth, i);
-    }
-    CRYPTO_w_unlock(CRYPTO_LOCK_EX_DATA);
-
-    if (mx > 0 && storage == NULL) {
-        CRYPTOerr(CRYPTO_F_CRYPTO_FREE_EX_DATA, ERR_R_MALLOC_FAILURE);
-        return;
-    }
-    for (i = 0; i < mx; i++) {
-        if (storage[i] && storage[i]->free_func) {
-            ptr = CRYPTO_get_ex_data(ad, i);
-            storage[i]->free_func(obj, ptr, ad, i,
-                                  storage[i]->argl, storage[i]->argp);
+    if (snap->ncb != 0) {
+        for (i = 0; i < snap->num; i++) {
+            cb = &snap->cb[i];
+            if (cb->free_func) {
+                ptr = CRYPTO_get_ex_data(ad, i);
+                cb->free_func(obj, ptr, ad, i, cb->argl, cb->argp);
+            }
         }
     }
 
-    if (storage != stack)
-        OPENSSL_free(storage);
     sk_void_free(ad->sk);
     ad->sk = NULL;
 }
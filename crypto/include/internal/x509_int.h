@@ -83,6 +83,17 @@ struct X509_name_st {
     /* canonical encoding used for rapid Name comparison */
     unsigned char *canon_enc;
     int canon_enclen;
+    /* non-cryptographic hash of canon_enc for internal lookup tables */
+    uint64_t canon_hash;
+    /*
+     * cached values of X509_NAME_hash() and X509_NAME_hash_old(), valid
+     * while the matching flag is non-zero. The flags are set atomically and
+     * cleared when the encoding is rebuilt.
+     */
+    unsigned long hash;
+    unsigned long hash_old;
+    int hash_set;
+    int hash_old_set;
 } /* X509_NAME */ ;
 
 /* PKCS#10 certificate request */
@@ -105,13 +116,14 @@ struct X509_req_st {
     X509_ALGOR sig_alg;         /* signature algorithm */
     ASN1_BIT_STRING *signature; /* signature */
     int references;
+    CRYPTO_RWLOCK *lock;
 };
 
 struct X509_crl_info_st {
     ASN1_INTEGER *version;      /* version: defaults to v1(0) so may be NULL */
     X509_ALGOR sig_alg;         /* signagture algorithm */
     X509_NAME *issuer;          /* CRL issuer name */
-    ASN1_TIME *lastUpdate;      /* lastUpdate field */
+    ASN1_TIME lastUpdate;       /* lastUpdate field */
     ASN1_TIME *nextUpdate;      /* nextUpdate field: optional */
     STACK_OF(X509_REVOKED) *revoked; /* revoked entries: optional */
     STACK_OF(X509_EXTENSION) *extensions;   /* extensions: optional */
@@ -124,6 +136,7 @@ struct X509_crl_st {
     ASN1_BIT_STRING signature; /* CRL signature */
     int references;
     int flags;
+    CRYPTO_RWLOCK *lock;
     /*
      * Cached copies of decoded extension values, since extensions
      * are optional any of these can be NULL.
@@ -142,11 +155,19 @@ struct X509_crl_st {
     /* alternative method to handle this CRL */
     const X509_CRL_METHOD *meth;
     void *meth_data;
+    /*
+     * Open addressed hash index of revoked entries by serial number: built
+     * on first lookup, revoked_idx_mask + 1 slots covering revoked_idx_num
+     * entries. Only accessed under the CRL lock.
+     */
+    X509_REVOKED **revoked_idx;
+    size_t revoked_idx_mask;
+    int revoked_idx_num;
 };
 
 struct x509_revoked_st {
     ASN1_INTEGER serialNumber; /* revoked entry serial number */
-    ASN1_TIME *revocationDate;  /* revocation date */
+    ASN1_TIME revocationDate;   /* revocation date */
     STACK_OF(X509_EXTENSION) *extensions;   /* CRL entry extensions: optional */
     /* decoded value of CRLissuer extension: set if indirect CRL */
     STACK_OF(GENERAL_NAME) *issuer;
@@ -193,7 +214,6 @@ struct x509_st {
     X509_ALGOR sig_alg;
     ASN1_BIT_STRING signature;
     int references;
-    char *name;
     CRYPTO_EX_DATA ex_data;
     /* These contain copies of various extension values */
     long ex_pathlen;
@@ -214,4 +234,5 @@ struct x509_st {
 # endif
     unsigned char sha1_hash[SHA_DIGEST_LENGTH];
     X509_CERT_AUX *aux;
+    CRYPTO_RWLOCK *lock;
 } /* X509 */ ;
@@ -164,7 +164,8 @@ static const char *const lock_names[CRYPTO_NUM_LOCKS] = {
     "comp",
     "fips",
     "fips2",
-#if CRYPTO_NUM_LOCKS != 41
+    "drbg",
+#if CRYPTO_NUM_LOCKS != 42
 # error "Inconsistency between crypto.h and cryptlib.c"
 #endif
 };
@@ -473,6 +474,13 @@ int CRYPTO_add_lock(int *pointer, int amount, int type, const char *file,
                     CRYPTO_get_lock_name(type), file, line);
         }
 #endif
+    } else if (locking_callback == NULL) {
+        /*
+         * Without a locking callback CRYPTO_lock() does nothing, so the
+         * native atomic add is the only protection there is.
+         */
+        if (!CRYPTO_atomic_add(pointer, amount, &ret, NULL))
+            *pointer = ret = *pointer + amount;
     } else {
         CRYPTO_lock(CRYPTO_LOCK | CRYPTO_WRITE, type, file, line);
 
@@ -80,6 +80,60 @@ static int call_malloc_debug = 1;
 static int call_malloc_debug = 0;
 #endif
 
+/*
+ * Optional per-thread cache in front of malloc(), see CRYPTO_set_mem_cache(),
+ * and per-thread allocation counters, see CRYPTO_set_mem_counters(). With
+ * either on, every block carries a header recording its usable size and size
+ * class. With the cache on, blocks of up to MEM_CACHE_MAX bytes are rounded
+ * up to a power of two and, when freed, kept on a free list of the freeing
+ * thread (at most MEM_CACHE_DEPTH per class) instead of going back to
+ * malloc().
+ */
+#define MEM_CACHE_MIN           16
+#define MEM_CACHE_CLASSES       8
+#define MEM_CACHE_MAX           (MEM_CACHE_MIN << (MEM_CACHE_CLASSES - 1))
+#define MEM_CACHE_DEPTH         64
+
+#ifndef SIZE_MAX
+# define SIZE_MAX    ((size_t)-1)
+#endif
+
+typedef union mem_cache_hdr_u {
+    struct {
+        size_t size;            /* Usable bytes after the header */
+        int cls;                /* Size class, or MEM_CACHE_CLASSES */
+    } h;
+    union mem_cache_hdr_u *next; /* Free list link, while cached */
+    long double align;
+} MEM_CACHE_HDR;
+
+typedef struct mem_cache_stats_st {
+    unsigned long allocs;
+    unsigned long hits;
+    unsigned long frees;
+} MEM_CACHE_STATS;
+
+typedef struct mem_cache_st {
+    MEM_CACHE_HDR *free[MEM_CACHE_CLASSES];
+    int count[MEM_CACHE_CLASSES];
+    /* The last entry counts blocks too large to cache */
+    MEM_CACHE_STATS stats[MEM_CACHE_CLASSES + 1];
+    /* CRYPTO_get_mem_counters() */
+    unsigned long allocs;
+    unsigned long frees;
+    size_t bytes;
+    size_t live;
+    size_t peak;
+} MEM_CACHE;
+
+static int mem_cache_on = 0;
+static int mem_count_on = 0;
+static CRYPTO_ONCE mem_cache_once = CRYPTO_ONCE_STATIC_INIT;
+static CRYPTO_THREAD_LOCAL mem_cache_key;
+static int mem_cache_key_ok = 0;
+/* Counts of threads that have exited, protected by CRYPTO_LOCK_MALLOC */
+static MEM_CACHE_STATS mem_cache_exited[MEM_CACHE_CLASSES + 1];
+
 int CRYPTO_set_mem_functions(
         void *(*m)(size_t, const char *, int),
         void *(*r)(void *, size_t, const char *, int),
@@ -104,6 +158,267 @@ int CRYPTO_set_mem_debug(int flag)
     return 1;
 }
 
+static void mem_cache_thread_free(void *arg)
+{
+    MEM_CACHE *cache = arg;
+    MEM_CACHE_HDR *hdr;
+    int i;
+
+    if (cache == NULL)
+        return;
+    for (i = 0; i < MEM_CACHE_CLASSES; i++) {
+        while ((hdr = cache->free[i]) != NULL) {
+            cache->free[i] = hdr->next;
+            free(hdr);
+        }
+    }
+    CRYPTO_w_lock(CRYPTO_LOCK_MALLOC);
+    for (i = 0; i <= MEM_CACHE_CLASSES; i++) {
+        mem_cache_exited[i].allocs += cache->stats[i].allocs;
+        mem_cache_exited[i].hits += cache->stats[i].hits;
+        mem_cache_exited[i].frees += cache->stats[i].frees;
+    }
+    CRYPTO_w_unlock(CRYPTO_LOCK_MALLOC);
+    free(cache);
+}
+
+static void mem_cache_init(void)
+{
+    mem_cache_key_ok = CRYPTO_THREAD_init_local(&mem_cache_key,
+                                                mem_cache_thread_free);
+}
+
+/*
+ * Return the calling thread's cache. With |create| set one is made if the
+ * thread has none; the cache itself comes straight from malloc().
+ */
+static MEM_CACHE *mem_cache_get(int create)
+{
+    MEM_CACHE *cache;
+
+    if (!CRYPTO_THREAD_run_once(&mem_cache_once, mem_cache_init)
+            || !mem_cache_key_ok)
+        return NULL;
+    cache = CRYPTO_THREAD_get_local(&mem_cache_key);
+    if (cache == NULL && create) {
+        if ((cache = calloc(1, sizeof(*cache))) == NULL)
+            return NULL;
+        if (!CRYPTO_THREAD_set_local(&mem_cache_key, cache)) {
+            free(cache);
+            return NULL;
+        }
+    }
+    return cache;
+}
+
+static void mem_count_alloc(MEM_CACHE *cache, size_t size)
+{
+    if (!mem_count_on || cache == NULL)
+        return;
+    cache->allocs++;
+    cache->bytes += size;
+    cache->live += size;
+    if (cache->live > cache->peak)
+        cache->peak = cache->live;
+}
+
+static void mem_count_free(MEM_CACHE *cache, size_t size)
+{
+    if (!mem_count_on || cache == NULL)
+        return;
+    cache->frees++;
+    /* The block may have come from another thread */
+    cache->live = cache->live > size ? cache->live - size : 0;
+}
+
+static void *mem_cache_malloc(size_t num)
+{
+    MEM_CACHE *cache = mem_cache_get(1);
+    MEM_CACHE_HDR *hdr;
+    size_t size = MEM_CACHE_MIN;
+    int cls = 0;
+
+    if (num > MEM_CACHE_MAX || !mem_cache_on) {
+        if (num > SIZE_MAX - sizeof(*hdr)
+                || (hdr = malloc(sizeof(*hdr) + num)) == NULL)
+            return NULL;
+        if (cache != NULL && mem_cache_on)
+            cache->stats[MEM_CACHE_CLASSES].allocs++;
+        mem_count_alloc(cache, num);
+        hdr->h.size = num;
+        hdr->h.cls = MEM_CACHE_CLASSES;
+        return hdr + 1;
+    }
+
+    while (size < num) {
+        size <<= 1;
+        cls++;
+    }
+    if (cache != NULL) {
+        cache->stats[cls].allocs++;
+        if ((hdr = cache->free[cls]) != NULL) {
+            cache->free[cls] = hdr->next;
+            cache->count[cls]--;
+            cache->stats[cls].hits++;
+            goto done;
+        }
+    }
+    if ((hdr = malloc(sizeof(*hdr) + size)) == NULL)
+        return NULL;
+ done:
+    mem_count_alloc(cache, size);
+    hdr->h.size = size;
+    hdr->h.cls = cls;
+    return hdr + 1;
+}
+
+static void mem_cache_free(void *str)
+{
+    MEM_CACHE_HDR *hdr = (MEM_CACHE_HDR *)str - 1;
+    MEM_CACHE *cache = mem_cache_get(mem_count_on);
+    int cls = hdr->h.cls;
+
+    mem_count_free(cache, hdr->h.size);
+    if (cache != NULL && mem_cache_on) {
+        cache->stats[cls].frees++;
+        if (cls < MEM_CACHE_CLASSES && cache->count[cls] < MEM_CACHE_DEPTH) {
+            hdr->next = cache->free[cls];
+            cache->free[cls] = hdr;
+            cache->count[cls]++;
+            return;
+        }
+    }
+    free(hdr);
+}
+
+static void *mem_cache_realloc(void *str, size_t num)
+{
+    MEM_CACHE_HDR *hdr = (MEM_CACHE_HDR *)str - 1;
+    MEM_CACHE *cache;
+    size_t old;
+    void *ret;
+
+    if (num <= hdr->h.size)
+        return str;
+    if (hdr->h.cls == MEM_CACHE_CLASSES
+            && (num > MEM_CACHE_MAX || !mem_cache_on)) {
+        old = hdr->h.size;
+        if (num > SIZE_MAX - sizeof(*hdr)
+                || (hdr = realloc(hdr, sizeof(*hdr) + num)) == NULL)
+            return NULL;
+        cache = mem_cache_get(mem_count_on);
+        mem_count_free(cache, old);
+        mem_count_alloc(cache, num);
+        hdr->h.size = num;
+        return hdr + 1;
+    }
+    if ((ret = mem_cache_malloc(num)) == NULL)
+        return NULL;
+    memcpy(ret, str, hdr->h.size);
+    mem_cache_free(str);
+    return ret;
+}
+
+/*
+ * The allocator underneath CRYPTO_malloc() and friends: the C library, or
+ * the header-carrying one above when the cache or counters are on.
+ */
+#define mem_hdr_on()    (mem_cache_on || mem_count_on)
+
+static void *mem_malloc(size_t num)
+{
+    return mem_hdr_on() ? mem_cache_malloc(num) : malloc(num);
+}
+
+static void *mem_realloc(void *str, size_t num)
+{
+    return mem_hdr_on() ? mem_cache_realloc(str, num) : realloc(str, num);
+}
+
+static void mem_free(void *str)
+{
+    if (!mem_hdr_on())
+        free(str);
+    else if (str != NULL)
+        mem_cache_free(str);
+}
+
+int CRYPTO_set_mem_cache(int flag)
+{
+    if (!allow_customize)
+        return 0;
+    mem_cache_on = flag != 0;
+    return 1;
+}
+
+int CRYPTO_get_mem_cache_stats(int size_class, size_t *size,
+                               unsigned long *allocs, unsigned long *hits,
+                               unsigned long *frees)
+{
+    MEM_CACHE *cache;
+    MEM_CACHE_STATS st;
+
+    if (size_class < 0 || size_class > MEM_CACHE_CLASSES)
+        return 0;
+
+    CRYPTO_r_lock(CRYPTO_LOCK_MALLOC);
+    st = mem_cache_exited[size_class];
+    CRYPTO_r_unlock(CRYPTO_LOCK_MALLOC);
+    if (mem_cache_on && (cache = mem_cache_get(0)) != NULL) {
+        st.allocs += cache->stats[size_class].allocs;
+        st.hits += cache->stats[size_class].hits;
+        st.frees += cache->stats[size_class].frees;
+    }
+
+    if (size != NULL)
+        *size = size_class < MEM_CACHE_CLASSES
+                ? (size_t)MEM_CACHE_MIN << size_class : 0;
+    if (allocs != NULL)
+        *allocs = st.allocs;
+    if (hits != NULL)
+        *hits = st.hits;
+    if (frees != NULL)
+        *frees = st.frees;
+    return 1;
+}
+
+int CRYPTO_set_mem_counters(int flag)
+{
+    if (!allow_customize)
+        return 0;
+    mem_count_on = flag != 0;
+    return 1;
+}
+
+int CRYPTO_get_mem_counters(unsigned long *allocs, unsigned long *frees,
+                            size_t *bytes, size_t *peak)
+{
+    MEM_CACHE *cache;
+
+    if (!mem_count_on || (cache = mem_cache_get(1)) == NULL)
+        return 0;
+    if (allocs != NULL)
+        *allocs = cache->allocs;
+    if (frees != NULL)
+        *frees = cache->frees;
+    if (bytes != NULL)
+        *bytes = cache->bytes;
+    if (peak != NULL)
+        *peak = cache->peak;
+    return 1;
+}
+
+void CRYPTO_reset_mem_counters(void)
+{
+    MEM_CACHE *cache;
+
+    if (!mem_count_on || (cache = mem_cache_get(0)) == NULL)
+        return;
+    cache->allocs = cache->frees = 0;
+    cache->bytes = 0;
+    cache->peak = cache->live;
+}
+
 void CRYPTO_get_mem_functions(
         void *(**m)(size_t, const char *, int),
         void *(**r)(void *, size_t, const char *, int),
@@ -128,15 +443,15 @@ void *CRYPTO_malloc(size_t num, const char *file, int line)
 #ifndef OPENSSL_NO_CRYPTO_MDEBUG
     if (call_malloc_debug) {
         CRYPTO_mem_debug_malloc(NULL, num, 0, file, line);
-        ret = malloc(num);
+        ret = mem_malloc(num);
         CRYPTO_mem_debug_malloc(ret, num, 1, file, line);
     } else {
-        ret = malloc(num);
+        ret = mem_malloc(num);
     }
 #else
     (void)file;
     (void)line;
-    ret = malloc(num);
+    ret = mem_malloc(num);
 #endif
 
 #ifndef OPENSSL_CPUID_OBJ
@@ -178,7 +493,7 @@ void *CRYPTO_realloc(void *str, size_t num, const char *file, int line)
     if (call_malloc_debug) {
         void *ret;
         CRYPTO_mem_debug_realloc(str, NULL, num, 0, file, line);
-        ret = realloc(str, num);
+        ret = mem_realloc(str, num);
         CRYPTO_mem_debug_realloc(str, ret, num, 1, file, line);
         return ret;
     }
@@ -186,7 +501,7 @@ void *CRYPTO_realloc(void *str, size_t num, const char *file, int line)
     (void)file;
     (void)line;
 #endif
-    return realloc(str, num);
+    return mem_realloc(str, num);
 
 }
 
@@ -214,15 +529,15 @@ void *CRYPTO_clear_realloc(void *str, size_t old_len, size_t num,
 #ifndef OPENSSL_NO_CRYPTO_MDEBUG
     if (call_malloc_debug) {
         CRYPTO_mem_debug_realloc(str, NULL, num, 0, file, line);
-        ret = malloc(num);
+        ret = mem_malloc(num);
         CRYPTO_mem_debug_realloc(str, ret, num, 1, file, line);
     } else {
-        ret = malloc(num);
+        ret = mem_malloc(num);
     }
 #else
     (void)file;
     (void)line;
-    ret = malloc(num);
+    ret = mem_malloc(num);
 #endif
 
     if (ret)
@@ -236,13 +551,13 @@ void CRYPTO_free(void *str)
 #ifndef OPENSSL_NO_CRYPTO_MDEBUG
     if (call_malloc_debug) {
         CRYPTO_mem_debug_free(str, 0);
-        free(str);
+        mem_free(str);
         CRYPTO_mem_debug_free(str, 1);
     } else {
-        free(str);
+        mem_free(str);
     }
 #else
-    free(str);
+    mem_free(str);
 #endif
 }
 
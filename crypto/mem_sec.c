@@ -26,8 +26,8 @@
 # include <fcntl.h>
 #endif
 
-#define LOCK()      CRYPTO_w_lock(CRYPTO_LOCK_MALLOC)
-#define UNLOCK()    CRYPTO_w_unlock(CRYPTO_LOCK_MALLOC)
+#define LOCK()      CRYPTO_THREAD_write_lock(sec_malloc_lock)
+#define UNLOCK()    CRYPTO_THREAD_unlock(sec_malloc_lock)
 #define CLEAR(p, s) OPENSSL_cleanse(p, s)
 #ifndef PAGE_SIZE
 # define PAGE_SIZE    4096
@@ -38,6 +38,8 @@ static size_t secure_mem_used;
 
 static int secure_mem_initialized;
 static int too_late;
+static CRYPTO_RWLOCK *sec_malloc_lock = NULL;
+static CRYPTO_ONCE secure_malloc_once = CRYPTO_ONCE_STATIC_INIT;
 
 /*
  * These are the functions that must be implemented by a secure heap (sh).
@@ -48,6 +50,15 @@ static void sh_free(char *ptr);
 static void sh_done(void);
 static int sh_actual_size(char *ptr);
 static int sh_allocated(const char *ptr);
+static void sh_cache_init(void);
+static char *sh_cache_malloc(size_t size);
+static int sh_cache_free(char *ptr, size_t size);
+
+static void secure_malloc_once_init(void)
+{
+    sec_malloc_lock = CRYPTO_THREAD_lock_new();
+    sh_cache_init();
+}
 #endif
 
 int CRYPTO_secure_malloc_init(size_t size, int minsize)
@@ -57,6 +68,9 @@ int CRYPTO_secure_malloc_init(size_t size, int minsize)
 
     if (too_late)
         return ret;
+    if (!CRYPTO_THREAD_run_once(&secure_malloc_once, secure_malloc_once_init)
+            || sec_malloc_lock == NULL)
+        return ret;
     LOCK();
     OPENSSL_assert(!secure_mem_initialized);
     if (!secure_mem_initialized) {
@@ -73,8 +87,11 @@ int CRYPTO_secure_malloc_init(size_t size, int minsize)
 void CRYPTO_secure_malloc_done()
 {
 #ifdef IMPLEMENTED
+    if (sec_malloc_lock == NULL)
+        return;
     LOCK();
     sh_done();
+    secure_mem_used = 0;
     secure_mem_initialized = 0;
     UNLOCK();
 #endif /* IMPLEMENTED */
@@ -99,6 +116,8 @@ void *CRYPTO_secure_malloc(size_t num, const char *file, int line)
         too_late = 1;
         return CRYPTO_malloc(num, file, line);
     }
+    if ((ret = sh_cache_malloc(num)) != NULL)
+        return ret;
     LOCK();
     ret = sh_malloc(num);
     actual_size = ret ? sh_actual_size(ret) : 0;
@@ -121,9 +140,11 @@ void CRYPTO_secure_free(void *ptr)
         CRYPTO_free(ptr);
         return;
     }
-    LOCK();
     actual_size = sh_actual_size(ptr);
     CLEAR(ptr, actual_size);
+    if (sh_cache_free(ptr, actual_size))
+        return;
+    LOCK();
     secure_mem_used -= actual_size;
     sh_free(ptr);
     UNLOCK();
@@ -135,14 +156,9 @@ void CRYPTO_secure_free(void *ptr)
 int CRYPTO_secure_allocated(const void *ptr)
 {
 #ifdef IMPLEMENTED
-    int ret;
-
     if (!secure_mem_initialized)
         return 0;
-    LOCK();
-    ret = sh_allocated(ptr);
-    UNLOCK();
-    return ret;
+    return sh_allocated(ptr);
 #else
     return 0;
 #endif /* IMPLEMENTED */
@@ -160,12 +176,7 @@ size_t CRYPTO_secure_used()
 size_t CRYPTO_secure_actual_size(void *ptr)
 {
 #ifdef IMPLEMENTED
-    size_t actual_size;
-
-    LOCK();
-    actual_size = sh_actual_size(ptr);
-    UNLOCK();
-    return actual_size;
+    return sh_actual_size(ptr);
 #else
     return 0;
 #endif
@@ -193,6 +204,13 @@ size_t CRYPTO_secure_actual_size(void *ptr)
  *
  * This code assumes eight-bit bytes.  The numbers 3 and 7 are all over the
  * place.
+ *
+ * Everything above is done with sec_malloc_lock held. In front of it, each
+ * thread keeps a few freed chunks of the smallest sizes, SH_CACHE_CLASSES
+ * of them starting at sh.minsize, and hands them out again without taking
+ * the lock. Chunks in a thread's cache stay allocated as far as the buddy
+ * allocator is concerned. sh.sizelist records the free list of every
+ * allocated chunk so its size can be found without the lock, too.
  */
 
 # define TESTBIT(t, b)  (t[(b) >> 3] &  (1 << ((b) & 7)))
@@ -223,10 +241,27 @@ typedef struct sh_st
     unsigned char *bittable;
     unsigned char *bitmalloc;
     int bittable_size; /* size in bits */
+    unsigned char *sizelist; /* list of the chunk at each minsize unit */
+    size_t cache_max; /* bytes a thread may keep in its cache */
+    unsigned int generation; /* bumped by sh_init(), voids thread caches */
 } SH;
 
 static SH sh;
 
+# define SH_CACHE_CLASSES 5
+# define SH_CACHE_DEPTH   8
+
+typedef struct sh_cache_st
+{
+    unsigned int generation;
+    size_t bytes;
+    int count[SH_CACHE_CLASSES];
+    char *free[SH_CACHE_CLASSES]; /* linked through their first word */
+} SH_CACHE;
+
+static CRYPTO_THREAD_LOCAL sh_cache_key;
+static int sh_cache_key_ok = 0;
+
 static int sh_getlist(char *ptr)
 {
     int list = sh.freelist_size - 1;
@@ -318,8 +353,10 @@ static int sh_init(size_t size, int minsize)
     int i, ret;
     size_t pgsize;
     size_t aligned;
+    unsigned int generation = sh.generation;
 
     memset(&sh, 0, sizeof sh);
+    sh.generation = generation + 1;
 
     /* make sure size and minsize are powers of 2 */
     OPENSSL_assert(size > 0);
@@ -354,6 +391,11 @@ static int sh_init(size_t size, int minsize)
     if (sh.bitmalloc == NULL)
         goto err;
 
+    sh.sizelist = OPENSSL_zalloc(sh.arena_size / sh.minsize);
+    if (sh.sizelist == NULL)
+        goto err;
+    sh.cache_max = sh.arena_size / 64;
+
     /* Allocate space for heap, and two extra pages as guards */
 #if defined(_SC_PAGE_SIZE) || defined (_SC_PAGESIZE)
     {
@@ -421,12 +463,17 @@ static int sh_init(size_t size, int minsize)
 
 static void sh_done()
 {
+    unsigned int generation = sh.generation;
+
     OPENSSL_free(sh.freelist);
     OPENSSL_free(sh.bittable);
     OPENSSL_free(sh.bitmalloc);
+    OPENSSL_free(sh.sizelist);
     if (sh.map_result != NULL && sh.map_size)
         munmap(sh.map_result, sh.map_size);
     memset(&sh, 0, sizeof sh);
+    /* Chunks still in thread caches belong to the old arena */
+    sh.generation = generation + 1;
 }
 
 static int sh_allocated(const char *ptr)
@@ -501,6 +548,7 @@ static char *sh_malloc(size_t size)
     OPENSSL_assert(sh_testbit(chunk, list, sh.bittable));
     sh_setbit(chunk, list, sh.bitmalloc);
     sh_remove_from_list(chunk, sh.freelist[list]);
+    sh.sizelist[(chunk - sh.arena) / sh.minsize] = list;
 
     OPENSSL_assert(WITHIN_ARENA(chunk));
 
@@ -546,15 +594,118 @@ static void sh_free(char *ptr)
     }
 }
 
+/* Called without the lock: |ptr| is allocated, so its entry is stable */
 static int sh_actual_size(char *ptr)
 {
-    int list;
-
     OPENSSL_assert(WITHIN_ARENA(ptr));
     if (!WITHIN_ARENA(ptr))
         return 0;
-    list = sh_getlist(ptr);
-    OPENSSL_assert(sh_testbit(ptr, list, sh.bittable));
-    return sh.arena_size / (1 << list);
+    return sh.arena_size >> sh.sizelist[(ptr - sh.arena) / sh.minsize];
+}
+
+/* Return a thread's cached chunks to the heap when it exits */
+static void sh_cache_thread_free(void *arg)
+{
+    SH_CACHE *cache = arg;
+    char *chunk;
+    int i;
+
+    if (cache == NULL)
+        return;
+    LOCK();
+    if (secure_mem_initialized && cache->generation == sh.generation) {
+        for (i = 0; i < SH_CACHE_CLASSES; i++) {
+            while ((chunk = cache->free[i]) != NULL) {
+                cache->free[i] = *(char **)chunk;
+                CLEAR(chunk, sizeof(char *));
+                secure_mem_used -= sh_actual_size(chunk);
+                sh_free(chunk);
+            }
+        }
+    }
+    UNLOCK();
+    CRYPTO_mem_ctrl(CRYPTO_MEM_CHECK_DISABLE);
+    OPENSSL_free(cache);
+    CRYPTO_mem_ctrl(CRYPTO_MEM_CHECK_ENABLE);
+}
+
+static void sh_cache_init(void)
+{
+    sh_cache_key_ok = CRYPTO_THREAD_init_local(&sh_cache_key,
+                                               sh_cache_thread_free);
+}
+
+static SH_CACHE *sh_cache_get(void)
+{
+    SH_CACHE *cache;
+
+    if (!sh_cache_key_ok)
+        return NULL;
+    cache = CRYPTO_THREAD_get_local(&sh_cache_key);
+    if (cache == NULL) {
+        CRYPTO_mem_ctrl(CRYPTO_MEM_CHECK_DISABLE);
+        cache = OPENSSL_zalloc(sizeof(*cache));
+        CRYPTO_mem_ctrl(CRYPTO_MEM_CHECK_ENABLE);
+        if (cache == NULL)
+            return NULL;
+        if (!CRYPTO_THREAD_set_local(&sh_cache_key, cache)) {
+            OPENSSL_free(cache);
+            return NULL;
+        }
+        cache->generation = sh.generation;
+    }
+    if (cache->generation != sh.generation) {
+        memset(cache, 0, sizeof(*cache));
+        cache->generation = sh.generation;
+    }
+    return cache;
+}
+
+/* The cache class for |size| bytes, or SH_CACHE_CLASSES if too big */
+static int sh_cache_class(size_t size)
+{
+    size_t i;
+    int cls = 0;
+
+    for (i = sh.minsize; i < size && cls < SH_CACHE_CLASSES; i <<= 1)
+        cls++;
+    return cls;
+}
+
+static char *sh_cache_malloc(size_t size)
+{
+    SH_CACHE *cache;
+    char *chunk;
+    int cls = sh_cache_class(size);
+
+    if (cls >= SH_CACHE_CLASSES || (cache = sh_cache_get()) == NULL
+            || (chunk = cache->free[cls]) == NULL)
+        return NULL;
+    cache->free[cls] = *(char **)chunk;
+    cache->count[cls]--;
+    cache->bytes -= (size_t)sh.minsize << cls;
+    /* The rest was cleansed by CRYPTO_secure_free() */
+    CLEAR(chunk, sizeof(char *));
+    return chunk;
+}
+
+/*
+ * Keep the chunk at |ptr|, of |size| bytes and already cleansed, in the
+ * thread's cache if there is room. Returns 1 if it was kept.
+ */
+static int sh_cache_free(char *ptr, size_t size)
+{
+    SH_CACHE *cache;
+    int cls = sh_cache_class(size);
+
+    if (cls >= SH_CACHE_CLASSES || (cache = sh_cache_get()) == NULL
+            || cache->count[cls] >= SH_CACHE_DEPTH
+            || cache->bytes + size > sh.cache_max)
+        return 0;
+    *(char **)ptr = cache->free[cls];
+    cache->free[cls] = ptr;
+    cache->count[cls]++;
+    cache->bytes += size;
+    return 1;
 }
 #endif /* IMPLEMENTED */
@@ -45,6 +45,47 @@ static STACK_OF(NAME_FUNCS) *name_funcs_stack;
 static unsigned long obj_name_hash(const OBJ_NAME *a);
 static int obj_name_cmp(const OBJ_NAME *a, const OBJ_NAME *b);
 
+/*
+ * A read-only copy of names_lh, made by OBJ_NAME_freeze(), with a perfect
+ * hash: every name has a slot of its own, found through the seed of its
+ * bucket, so a lookup is two hashes and one comparison. Aliases are already
+ * resolved. OBJ_NAME_get() uses it without locking while it is current.
+ * Adding or removing a name, or changing the functions of a type, retires
+ * it. Changing names_lh while other threads look names up has never been
+ * safe, but a lookup that has just loaded the snapshot may still be using
+ * it, so the last retired snapshot is only freed when the next one is
+ * retired, or by OBJ_NAME_cleanup(-1).
+ */
+typedef struct name_snap_entry_st {
+    OBJ_NAME on;
+    const char *resolved;       /* |on.data| after following aliases */
+} NAME_SNAP_ENTRY;
+
+typedef struct name_snapshot_st {
+    unsigned int nbuckets;      /* Power of 2 */
+    unsigned int nslots;        /* Power of 2 */
+    unsigned int *seeds;        /* One per bucket */
+    NAME_SNAP_ENTRY **slots;
+    NAME_SNAP_ENTRY *entries;
+    int num;
+} NAME_SNAPSHOT;
+
+static NAME_SNAPSHOT *names_snap = NULL;
+static NAME_SNAPSHOT *names_snap_retired = NULL;
+
+#if defined(__ATOMIC_ACQUIRE)
+# define names_snap_load()       __atomic_load_n(&names_snap, __ATOMIC_ACQUIRE)
+# define names_snap_store(v)     __atomic_store_n(&names_snap, (v), \
+                                                  __ATOMIC_RELEASE)
+#else
+# define names_snap_load()       (*(NAME_SNAPSHOT *volatile *)&names_snap)
+# define names_snap_store(v)     (*(NAME_SNAPSHOT *volatile *)&names_snap = (v))
+#endif
+
+static void names_snap_retire(void);
+static const NAME_SNAP_ENTRY *names_snap_find(const NAME_SNAPSHOT *snap,
+                                              const OBJ_NAME *on);
+
 int OBJ_NAME_init(void)
 {
     if (names_lh != NULL)
@@ -89,6 +130,8 @@ int OBJ_NAME_new_index(unsigned long (*hash_func) (const char *),
         CRYPTO_mem_ctrl(CRYPTO_MEM_CHECK_ENABLE);
     }
     name_funcs = sk_NAME_FUNCS_value(name_funcs_stack, ret);
+    /* The snapshot was placed with the old functions */
+    names_snap_retire();
     if (hash_func != NULL)
         name_funcs->hash_func = hash_func;
     if (cmp_func != NULL)
@@ -133,6 +176,7 @@ static unsigned long obj_name_hash(const OBJ_NAME *a)
 const char *OBJ_NAME_get(const char *name, int type)
 {
     OBJ_NAME on, *ret;
+    const NAME_SNAPSHOT *snap;
     int num = 0, alias;
 
     if (name == NULL)
@@ -146,6 +190,14 @@ const char *OBJ_NAME_get(const char *name, int type)
     on.name = name;
     on.type = type;
 
+    if ((snap = names_snap_load()) != NULL) {
+        const NAME_SNAP_ENTRY *e = names_snap_find(snap, &on);
+
+        if (e == NULL)
+            return NULL;
+        return alias ? e->on.data : e->resolved;
+    }
+
     for (;;) {
         ret = lh_OBJ_NAME_retrieve(names_lh, &on);
         if (ret == NULL)
@@ -182,11 +234,14 @@ int OBJ_NAME_add(const char *name, int type, const char *data)
     onp->type = type;
     onp->data = data;
 
+    names_snap_retire();
     ret = lh_OBJ_NAME_insert(names_lh, onp);
     if (ret != NULL) {
         /* free things */
         if ((name_funcs_stack != NULL)
-            && (sk_NAME_FUNCS_num(name_funcs_stack) > ret->type)) {
+            && (sk_NAME_FUNCS_num(name_funcs_stack) > ret->type)
+            && (sk_NAME_FUNCS_value(name_funcs_stack,
+                                    ret->type)->free_func != NULL)) {
             /*
              * XXX: I'm not sure I understand why the free function should
              * get three arguments... -- Richard Levitte
@@ -215,11 +270,14 @@ int OBJ_NAME_remove(const char *name, int type)
     type &= ~OBJ_NAME_ALIAS;
     on.name = name;
     on.type = type;
+    names_snap_retire();
     ret = lh_OBJ_NAME_delete(names_lh, &on);
     if (ret != NULL) {
         /* free things */
         if ((name_funcs_stack != NULL)
-            && (sk_NAME_FUNCS_num(name_funcs_stack) > ret->type)) {
+            && (sk_NAME_FUNCS_num(name_funcs_stack) > ret->type)
+            && (sk_NAME_FUNCS_value(name_funcs_stack,
+                                    ret->type)->free_func != NULL)) {
             /*
              * XXX: I'm not sure I understand why the free function should
              * get three arguments... -- Richard Levitte
@@ -331,6 +389,12 @@ void OBJ_NAME_cleanup(int type)
     if (names_lh == NULL)
         return;
 
+    names_snap_retire();
+    if (type < 0) {
+        OPENSSL_free(names_snap_retired);
+        names_snap_retired = NULL;
+    }
+
     free_type = type;
     down_load = lh_OBJ_NAME_get_down_load(names_lh);
     lh_OBJ_NAME_set_down_load(names_lh, 0);
@@ -344,3 +408,191 @@ void OBJ_NAME_cleanup(int type)
     } else
         lh_OBJ_NAME_set_down_load(names_lh, down_load);
 }
+
+/* Spread the bits of |h| for bucket and slot selection */
+static unsigned int names_snap_mix(unsigned long h, unsigned int seed)
+{
+    unsigned int x = (unsigned int)(h ^ (h >> 31 >> 1)) ^ (seed * 0x9e3779b9U);
+
+    x ^= x >> 16;
+    x *= 0x85ebca6bU;
+    x ^= x >> 13;
+    x *= 0xc2b2ae35U;
+    x ^= x >> 16;
+    return x;
+}
+
+static const NAME_SNAP_ENTRY *names_snap_find(const NAME_SNAPSHOT *snap,
+                                              const OBJ_NAME *on)
+{
+    unsigned long h = obj_name_hash(on);
+    unsigned int b = names_snap_mix(h, 0) & (snap->nbuckets - 1);
+    const NAME_SNAP_ENTRY *e;
+
+    e = snap->slots[names_snap_mix(h, snap->seeds[b]) & (snap->nslots - 1)];
+    if (e == NULL || obj_name_cmp(&e->on, on) != 0)
+        return NULL;
+    return e;
+}
+
+static void names_snap_retire(void)
+{
+    NAME_SNAPSHOT *snap = names_snap;
+
+    if (snap == NULL)
+        return;
+    names_snap_store(NULL);
+    OPENSSL_free(names_snap_retired);
+    names_snap_retired = snap;
+}
+
+static void names_snap_collect(const OBJ_NAME *onp, NAME_SNAPSHOT *snap)
+{
+    NAME_SNAP_ENTRY *e = &snap->entries[snap->num++];
+    OBJ_NAME on = *onp;
+    const OBJ_NAME *ret;
+    int num = 0;
+
+    e->on = *onp;
+    /* Follow aliases just as OBJ_NAME_get() does */
+    while ((ret = lh_OBJ_NAME_retrieve(names_lh, &on)) != NULL && ret->alias) {
+        if (++num > 10) {
+            ret = NULL;
+            break;
+        }
+        on.name = ret->data;
+    }
+    e->resolved = ret != NULL ? ret->data : NULL;
+}
+
+IMPLEMENT_LHASH_DOALL_ARG_CONST(OBJ_NAME, NAME_SNAPSHOT);
+
+typedef struct {
+    unsigned int bucket;
+    unsigned int size;
+} NAME_SNAP_BUCKET;
+
+static int names_snap_bucket_cmp(const void *a_, const void *b_)
+{
+    const NAME_SNAP_BUCKET *a = a_, *b = b_;
+
+    return (int)b->size - (int)a->size;
+}
+
+/*
+ * Find a seed for each bucket, largest first, that sends all its names to
+ * free slots. With twice as many slots as names this takes a few tries per
+ * bucket.
+ */
+static int names_snap_place(NAME_SNAPSHOT *snap, unsigned long *hashes,
+                            unsigned int *bucket_of, NAME_SNAP_BUCKET *order)
+{
+    unsigned int i, j, k, seed, slot, n = snap->num;
+    unsigned int *members = NULL, *placed = NULL;
+    int ok = 0;
+
+    members = OPENSSL_malloc(sizeof(*members) * n);
+    placed = OPENSSL_malloc(sizeof(*placed) * n);
+    if (members == NULL || placed == NULL)
+        goto err;
+
+    for (i = 0; i < snap->nbuckets; i++) {
+        order[i].bucket = i;
+        order[i].size = 0;
+    }
+    for (i = 0; i < n; i++)
+        order[bucket_of[i]].size++;
+    qsort(order, snap->nbuckets, sizeof(*order), names_snap_bucket_cmp);
+
+    for (i = 0; i < snap->nbuckets && order[i].size > 0; i++) {
+        unsigned int b = order[i].bucket, m = 0;
+
+        for (j = 0; j < n; j++)
+            if (bucket_of[j] == b)
+                members[m++] = j;
+        for (seed = 1; seed < 0x10000; seed++) {
+            for (j = 0; j < m; j++) {
+                slot = names_snap_mix(hashes[members[j]], seed)
+                       & (snap->nslots - 1);
+                for (k = 0; k < j; k++)
+                    if (placed[k] == slot)
+                        break;
+                if (k < j || snap->slots[slot] != NULL)
+                    break;
+                placed[j] = slot;
+            }
+            if (j == m)
+                break;
+        }
+        if (seed == 0x10000)
+            goto err;
+        snap->seeds[b] = seed;
+        for (j = 0; j < m; j++)
+            snap->slots[placed[j]] = &snap->entries[members[j]];
+    }
+    ok = 1;
+ err:
+    OPENSSL_free(members);
+    OPENSSL_free(placed);
+    return ok;
+}
+
+int OBJ_NAME_freeze(void)
+{
+    NAME_SNAPSHOT *snap = NULL;
+    unsigned long *hashes = NULL;
+    unsigned int *bucket_of = NULL;
+    NAME_SNAP_BUCKET *order = NULL;
+    unsigned int i, n, nbuckets = 1, nslots = 1;
+    size_t len;
+    int ok = 0;
+
+    if (names_lh == NULL)
+        return 0;
+    /* Nothing has changed since the last freeze */
+    if (names_snap != NULL)
+        return 1;
+    n = lh_OBJ_NAME_num_items(names_lh);
+    while (nbuckets < n / 2)
+        nbuckets <<= 1;
+    while (nslots < n * 2)
+        nslots <<= 1;
+
+    /* The snapshot and its tables are one allocation */
+    len = sizeof(*snap) + sizeof(*snap->seeds) * nbuckets
+          + sizeof(*snap->slots) * nslots + sizeof(*snap->entries) * n;
+    CRYPTO_mem_ctrl(CRYPTO_MEM_CHECK_DISABLE);
+    snap = OPENSSL_zalloc(len);
+    CRYPTO_mem_ctrl(CRYPTO_MEM_CHECK_ENABLE);
+    hashes = OPENSSL_malloc(sizeof(*hashes) * (n + 1));
+    bucket_of = OPENSSL_malloc(sizeof(*bucket_of) * (n + 1));
+    order = OPENSSL_malloc(sizeof(*order) * nbuckets);
+    if (snap == NULL || hashes == NULL || bucket_of == NULL || order == NULL)
+        goto err;
+    snap->nbuckets = nbuckets;
+    snap->nslots = nslots;
+    snap->slots = (NAME_SNAP_ENTRY **)(snap + 1);
+    snap->entries = (NAME_SNAP_ENTRY *)(snap->slots + nslots);
+    snap->seeds = (unsigned int *)(snap->entries + n);
+
+    lh_OBJ_NAME_doall_NAME_SNAPSHOT(names_lh, names_snap_collect, snap);
+    if ((unsigned int)snap->num != n)
+        goto err;
+    for (i = 0; i < n; i++) {
+        hashes[i] = obj_name_hash(&snap->entries[i].on);
+        bucket_of[i] = names_snap_mix(hashes[i], 0) & (nbuckets - 1);
+    }
+    if (!names_snap_place(snap, hashes, bucket_of, order))
+        goto err;
+
+    names_snap_retire();
+    names_snap_store(snap);
+    snap = NULL;
+    ok = 1;
+ err:
+    OPENSSL_free(snap);
+    OPENSSL_free(hashes);
+    OPENSSL_free(bucket_of);
+    OPENSSL_free(order);
+    return ok;
+}
@@ -70,10 +70,6 @@
 /* obj_dat.h is generated from objects.h by obj_dat.pl */
 #include "obj_dat.h"
 
-DECLARE_OBJ_BSEARCH_CMP_FN(const ASN1_OBJECT *, unsigned int, sn);
-DECLARE_OBJ_BSEARCH_CMP_FN(const ASN1_OBJECT *, unsigned int, ln);
-DECLARE_OBJ_BSEARCH_CMP_FN(const ASN1_OBJECT *, unsigned int, obj);
-
 #define ADDED_DATA      0
 #define ADDED_SNAME     1
 #define ADDED_LNAME     2
@@ -87,20 +83,32 @@ struct added_obj_st {
 static int new_nid = NUM_NID;
 static LHASH_OF(ADDED_OBJ) *added = NULL;
 
-static int sn_cmp(const ASN1_OBJECT *const *a, const unsigned int *b)
+/*
+ * Look |p| up in one of the generated perfect hashes. FNV-1a picks the
+ * bucket, whose seed then mixes it with a second hash into the only slot the
+ * key can be in: this must match hash_it() and slot_it() in obj_dat.pl.
+ * The caller must compare the key against the returned entry of nid_objs,
+ * since keys that are not in the table land on an arbitrary slot.
+ */
+static unsigned int obj_hash_find(const unsigned short *seeds,
+                                  unsigned long nbuckets,
+                                  const unsigned short *nids,
+                                  unsigned long nslots,
+                                  const unsigned char *p, size_t len)
 {
-    return (strcmp((*a)->sn, nid_objs[*b].sn));
-}
-
-IMPLEMENT_OBJ_BSEARCH_CMP_FN(const ASN1_OBJECT *, unsigned int, sn);
+    unsigned long h1 = 2166136261UL, h2 = 5381, x;
 
-static int ln_cmp(const ASN1_OBJECT *const *a, const unsigned int *b)
-{
-    return (strcmp((*a)->ln, nid_objs[*b].ln));
+    while (len-- > 0) {
+        h1 = ((h1 ^ *p) * 16777619UL) & 0xffffffffUL;
+        h2 = ((h2 * 33) ^ *p++) & 0xffffffffUL;
+    }
+    x = (h2 + seeds[h1 % nbuckets] * h1) & 0xffffffffUL;
+    x ^= x >> 15;
+    x = (x * 0x2c1b3c6dUL) & 0xffffffffUL;
+    x ^= x >> 12;
+    return nids[x % nslots];
 }
 
-IMPLEMENT_OBJ_BSEARCH_CMP_FN(const ASN1_OBJECT *, unsigned int, ln);
-
 static unsigned long added_obj_hash(const ADDED_OBJ *ca)
 {
     const ASN1_OBJECT *a;
@@ -363,25 +371,9 @@ const char *OBJ_nid2ln(int n)
     }
 }
 
-static int obj_cmp(const ASN1_OBJECT *const *ap, const unsigned int *bp)
-{
-    int j;
-    const ASN1_OBJECT *a = *ap;
-    const ASN1_OBJECT *b = &nid_objs[*bp];
-
-    j = (a->length - b->length);
-    if (j)
-        return (j);
-    if (a->length == 0)
-        return 0;
-    return (memcmp(a->data, b->data, a->length));
-}
-
-IMPLEMENT_OBJ_BSEARCH_CMP_FN(const ASN1_OBJECT *, unsigned int, obj);
-
 int OBJ_obj2nid(const ASN1_OBJECT *a)
 {
-    const unsigned int *op;
+    const ASN1_OBJECT *o;
     ADDED_OBJ ad, *adp;
 
     if (a == NULL)
@@ -399,10 +391,12 @@ int OBJ_obj2nid(const ASN1_OBJECT *a)
         if (adp != NULL)
             return (adp->obj->nid);
     }
-    op = OBJ_bsearch_obj(&a, obj_objs, NUM_OBJ);
-    if (op == NULL)
+    o = &nid_objs[obj_hash_find(obj_hash_seeds, OBJ_HASH_BUCKETS,
+                                obj_hash_nids, OBJ_HASH_SLOTS,
+                                a->data, a->length)];
+    if (o->length != a->length || memcmp(o->data, a->data, a->length) != 0)
         return (NID_undef);
-    return (nid_objs[*op].nid);
+    return (o->nid);
 }
 
 /*
@@ -416,7 +410,7 @@ ASN1_OBJECT *OBJ_txt2obj(const char *s, int no_name)
 {
     int nid = NID_undef;
     ASN1_OBJECT *op = NULL;
-    unsigned char *buf;
+    unsigned char tbuf[64], *buf = tbuf;
     unsigned char *p;
     const unsigned char *cp;
     int i, j;
@@ -439,7 +433,11 @@ ASN1_OBJECT *OBJ_txt2obj(const char *s, int no_name)
     /* Work out total size */
     j = ASN1_object_size(0, i, V_ASN1_OBJECT);
 
-    if ((buf = OPENSSL_malloc(j)) == NULL)
+    /*
+     * Registered OIDs decode to the shared table entry, so short ones need
+     * not touch the heap at all.
+     */
+    if (j > (int)sizeof(tbuf) && (buf = OPENSSL_malloc(j)) == NULL)
         return NULL;
 
     p = buf;
@@ -450,7 +448,8 @@ ASN1_OBJECT *OBJ_txt2obj(const char *s, int no_name)
 
     cp = buf;
     op = d2i_ASN1_OBJECT(NULL, &cp, j);
-    OPENSSL_free(buf);
+    if (buf != tbuf)
+        OPENSSL_free(buf);
     return op;
 }
 
@@ -601,9 +600,8 @@ int OBJ_txt2nid(const char *s)
 int OBJ_ln2nid(const char *s)
 {
     ASN1_OBJECT o;
-    const ASN1_OBJECT *oo = &o;
+    const ASN1_OBJECT *op;
     ADDED_OBJ ad, *adp;
-    const unsigned int *op;
 
     o.ln = s;
     if (added != NULL) {
@@ -613,18 +611,28 @@ int OBJ_ln2nid(const char *s)
         if (adp != NULL)
             return (adp->obj->nid);
     }
-    op = OBJ_bsearch_ln(&oo, ln_objs, NUM_LN);
-    if (op == NULL)
-        return (NID_undef);
-    return (nid_objs[*op].nid);
+    op = &nid_objs[obj_hash_find(ln_hash_seeds, LN_HASH_BUCKETS,
+                                 ln_hash_nids, LN_HASH_SLOTS,
+                                 (const unsigned char *)s, strlen(s))];
+    if (strcmp(op->ln, s) == 0)
+        return (op->nid);
+#ifdef CHARSET_EBCDIC
+    /*
+     * The tables are hashed over the ASCII names, so fall back to a linear
+     * search as OBJ_bsearch_ex_() does.
+     */
+    for (op = nid_objs; op < nid_objs + NUM_NID; op++)
+        if (op->ln != NULL && strcmp(op->ln, s) == 0)
+            return (op->nid);
+#endif
+    return (NID_undef);
 }
 
 int OBJ_sn2nid(const char *s)
 {
     ASN1_OBJECT o;
-    const ASN1_OBJECT *oo = &o;
+    const ASN1_OBJECT *op;
     ADDED_OBJ ad, *adp;
-    const unsigned int *op;
 
     o.sn = s;
     if (added != NULL) {
@@ -634,10 +642,21 @@ int OBJ_sn2nid(const char *s)
         if (adp != NULL)
             return (adp->obj->nid);
     }
-    op = OBJ_bsearch_sn(&oo, sn_objs, NUM_SN);
-    if (op == NULL)
-        return (NID_undef);
-    return (nid_objs[*op].nid);
+    op = &nid_objs[obj_hash_find(sn_hash_seeds, SN_HASH_BUCKETS,
+                                 sn_hash_nids, SN_HASH_SLOTS,
+                                 (const unsigned char *)s, strlen(s))];
+    if (strcmp(op->sn, s) == 0)
+        return (op->nid);
+#ifdef CHARSET_EBCDIC
+    /*
+     * The tables are hashed over the ASCII names, so fall back to a linear
+     * search as OBJ_bsearch_ex_() does.
+     */
+    for (op = nid_objs; op < nid_objs + NUM_NID; op++)
+        if (op->sn != NULL && strcmp(op->sn, s) == 0)
+            return (op->nid);
+#endif
+    return (NID_undef);
 }
 
 const void *OBJ_bsearch_(const void *key, const void *base, int num, int size,
@@ -145,27 +145,21 @@ for ($i=0; $i<$n; $i++)
 		}
 	}
 
-@a=grep(defined($sn{$nid{$_}}),0 .. $n);
-foreach (sort { $sn{$nid{$a}} cmp $sn{$nid{$b}} } @a)
+# The name and OID lookups go through perfect hashes rather than
+# binary searches over sorted index tables.  Where two NIDs share a key
+# the higher one wins, which is what the binary searches returned.
+%snh=();
+%lnh=();
+%obh=();
+foreach (grep(defined($nid{$_}),0 .. $n))
 	{
-	push(@sn,sprintf("%2d,\t/* \"$sn{$nid{$_}}\" */\n",$_));
-	}
-
-@a=grep(defined($ln{$nid{$_}}),0 .. $n);
-foreach (sort { $ln{$nid{$a}} cmp $ln{$nid{$b}} } @a)
-	{
-	push(@ln,sprintf("%2d,\t/* \"$ln{$nid{$_}}\" */\n",$_));
-	}
-
-@a=grep(defined($obj{$nid{$_}}),0 .. $n);
-foreach (sort obj_cmp @a)
-	{
-	$m=$obj{$nid{$_}};
-	$v=$objd{$m};
-	$v =~ s/L//g;
-	$v =~ s/,/ /g;
-	push(@ob,sprintf("%2d,\t/* %-32s %s */\n",$_,$m,$v));
+	$snh{$sn{$nid{$_}}}=$_;
+	$lnh{$ln{$nid{$_}}}=$_;
+	next unless defined($obj_len{$obj{$nid{$_}}});
+	$v=$obj_der{$obj{$nid{$_}}};
+	$obh{pack("C*",map(hex,split(/,/,$v)))}=$_;
 	}
+die "Too many NIDs for the hash tables" if $n > 0xffff;
 
 print OUT <<'EOF';
 /* crypto/objects/obj_dat.h */
@@ -234,10 +228,7 @@ print OUT <<'EOF';
 
 EOF
 
-printf OUT "#define NUM_NID %d\n",$n;
-printf OUT "#define NUM_SN %d\n",$#sn+1;
-printf OUT "#define NUM_LN %d\n",$#ln+1;
-printf OUT "#define NUM_OBJ %d\n\n",$#ob+1;
+printf OUT "#define NUM_NID %d\n\n",$n;
 
 printf OUT "static const unsigned char lvalues[%d]={\n",$lvalues+1;
 print OUT @lvalues;
@@ -267,17 +258,9 @@ foreach (@out)
 	}
 print  OUT "};\n\n";
 
-printf OUT "static const unsigned int sn_objs[NUM_SN]={\n";
-print  OUT @sn;
-print  OUT "};\n\n";
-
-printf OUT "static const unsigned int ln_objs[NUM_LN]={\n";
-print  OUT @ln;
-print  OUT "};\n\n";
-
-printf OUT "static const unsigned int obj_objs[NUM_OBJ]={\n";
-print  OUT @ob;
-print  OUT "};\n\n";
+&print_hash("SN",*snh);
+&print_hash("LN",*lnh);
+&print_hash("OBJ",*obh);
 
 close OUT;
 
@@ -305,3 +288,105 @@ sub der_it
 		}
 	return($ret);
 	}
+
+# FNV-1a and a djb2 variant side by side: this must match
+# obj_hash_find() in obj_dat.c
+sub hash_it
+	{
+	my($s)=@_;
+	my($h1,$h2)=(2166136261,5381);
+
+	foreach (unpack("C*",$s))
+		{
+		$h1=(($h1 ^ $_) * 16777619) & 0xffffffff;
+		$h2=(($h2 * 33) ^ $_) & 0xffffffff;
+		}
+	return($h1,$h2);
+	}
+
+# Combine both hashes of a key with a bucket's seed: this must match
+# obj_hash_find() in obj_dat.c
+sub slot_it
+	{
+	my($h1,$h2,$seed)=@_;
+	my $x=($h2 + $seed * $h1) & 0xffffffff;
+
+	$x^=$x >> 15;
+	$x=($x * 0x2c1b3c6d) & 0xffffffff;
+	$x^=$x >> 12;
+	return($x);
+	}
+
+# Two level perfect hash over the keys of %h (key => nid): the first hash
+# of a key picks its bucket, and the seed stored for the bucket combines
+# both hashes into the key's slot.  Buckets are placed largest first,
+# trying seeds until none of their keys collide with each other or with a
+# slot that is already taken.
+sub perfect_hash
+	{
+	local(*h)=@_;
+	my @keys=sort keys %h;
+	my $nb=@keys/2+1;
+	my $ns=@keys*5/4+1;
+	my(%h1,%h2,@buckets,@seeds,@slots,@taken,%used,$b,$k,$s,$seed,$ok);
+
+	foreach $k (@keys)
+		{
+		($h1{$k},$h2{$k})=&hash_it($k);
+		push(@{$buckets[$h1{$k} % $nb]},$k);
+		}
+	@slots=(0) x $ns;
+	@seeds=(0) x $nb;
+	foreach $b (sort { scalar(@{$buckets[$b] || []}) <=>
+			   scalar(@{$buckets[$a] || []}) || $a <=> $b } 0 .. $nb-1)
+		{
+		next unless defined($buckets[$b]);
+		for ($seed=1; ; $seed++)
+			{
+			die "Can't place hash bucket $b" if $seed > 0xffff;
+			%used=();
+			$ok=1;
+			foreach $k (@{$buckets[$b]})
+				{
+				$s=&slot_it($h1{$k},$h2{$k},$seed) % $ns;
+				if ($taken[$s] || defined($used{$s}))
+					{ $ok=0; last; }
+				$used{$s}=$k;
+				}
+			last if $ok;
+			}
+		$seeds[$b]=$seed;
+		foreach $s (keys %used)
+			{
+			$taken[$s]=1;
+			$slots[$s]=$h{$used{$s}};
+			}
+		}
+	return(\@seeds,\@slots);
+	}
+
+sub print_array
+	{
+	my($name,$size,$a)=@_;
+	my $i;
+
+	printf OUT "static const unsigned short %s[%s]={\n",$name,$size;
+	for ($i=0; $i<@$a; $i++)
+		{
+		printf OUT "%s%4d,",($i % 10) ? "" : "\t",$$a[$i];
+		print OUT "\n" if ($i % 10) == 9 || $i == $#$a;
+		}
+	print OUT "};\n\n";
+	}
+
+sub print_hash
+	{
+	my($name,$h)=@_;
+	my($seeds,$slots)=&perfect_hash($h);
+	my $lc=lc($name);
+
+	printf OUT "#define %s_HASH_BUCKETS %d\n",$name,scalar(@$seeds);
+	printf OUT "#define %s_HASH_SLOTS %d\n\n",$name,scalar(@$slots);
+	&print_array("${lc}_hash_seeds","${name}_HASH_BUCKETS",$seeds);
+	&print_array("${lc}_hash_nids","${name}_HASH_SLOTS",$slots);
+	}
@@ -0,0 +1,441 @@
+/* crypto/rand/drbg_rand.c */
+/* ====================================================================
+ * Copyright (c) 2016 The OpenSSL Project.  All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * 3. All advertising materials mentioning features or use of this
+ *    software must display the following acknowledgment:
+ *    "This product includes software developed by the OpenSSL Project
+ *    for use in the OpenSSL Toolkit. (http://www.openssl.org/)"
+ *
+ * 4. The names "OpenSSL Toolkit" and "OpenSSL Project" must not be used to
+ *    endorse or promote products derived from this software without
+ *    prior written permission. For written permission, please contact
+ *    openssl-core@openssl.org.
+ *
+ * 5. Products derived from this software may not be called "OpenSSL"
+ *    nor may "OpenSSL" appear in their names without prior written
+ *    permission of the OpenSSL Project.
+ *
+ * 6. Redistributions of any form whatsoever must retain the following
+ *    acknowledgment:
+ *    "This product includes software developed by the OpenSSL Project
+ *    for use in the OpenSSL Toolkit (http://www.openssl.org/)"
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE OpenSSL PROJECT ``AS IS'' AND ANY
+ * EXPRESSED OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE OpenSSL PROJECT OR
+ * ITS CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT
+ * NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ * ====================================================================
+ *
+ * This product includes cryptographic software written by Eric Young
+ * (eay@cryptsoft.com).  This product includes software written by Tim
+ * Hudson (tjh@cryptsoft.com).
+ *
+ */
+
+/*
+ * NIST SP 800-90A CTR_DRBG with AES-256 and no derivation function.
+ *
+ * A single master DRBG is seeded from the md_rand pool, which is still fed
+ * by RAND_poll(), RAND_seed() and RAND_add(), mixed with a fresh read from
+ * the operating system on every master reseed. Every thread generates from
+ * its own child DRBG, seeded from the master, so RAND_bytes() takes no lock
+ * unless the child has to reseed.
+ */
+
+#include <string.h>
+#include "e_os.h"
+#include <openssl/crypto.h>
+#include <openssl/evp.h>
+#include <openssl/rand.h>
+#include <openssl/err.h>
+#include "rand_lcl.h"
+
+#define DRBG_KEYLEN                     32
+#define DRBG_BLOCKLEN                   16
+#define DRBG_SEEDLEN                    (DRBG_KEYLEN + DRBG_BLOCKLEN)
+/* Largest single generate request: SP 800-90A allows 2^19 bits */
+#define DRBG_MAX_REQUEST                (1 << 16)
+/* Generate requests served by a child before it reseeds from the master */
+#define DRBG_CHILD_RESEED_INTERVAL      (1 << 16)
+/* Generate requests served by the master before it reseeds from the pool */
+#define DRBG_MASTER_RESEED_INTERVAL     (1 << 8)
+
+typedef struct drbg_ctx_st {
+    /* AES-256-CTR context keyed with K */
+    EVP_CIPHER_CTX *cipher;
+    unsigned char K[DRBG_KEYLEN];
+    unsigned char V[DRBG_BLOCKLEN];
+    unsigned int reseed_counter;
+    /* Value of drbg_reseed_gen when the master was last seeded */
+    int gen;
+#ifndef GETPID_IS_MEANINGLESS
+    pid_t pid;
+#endif
+    int seeded;
+} DRBG_CTX;
+
+static CRYPTO_ONCE drbg_once = CRYPTO_ONCE_STATIC_INIT;
+static CRYPTO_THREAD_LOCAL drbg_key;
+static int drbg_key_ok = 0;
+
+/* Protected by CRYPTO_LOCK_DRBG */
+static DRBG_CTX drbg_master;
+
+/*
+ * Incremented by RAND_seed() and RAND_add() so that every DRBG reseeds
+ * before its next output. Only accessed through CRYPTO_atomic_add(), which
+ * needs drbg_gen_lock where there are no atomic operations.
+ */
+static int drbg_reseed_gen = 1;
+static CRYPTO_RWLOCK *drbg_gen_lock = NULL;
+
+static int drbg_seed_bytes(const void *buf, int num);
+static int drbg_bytes(unsigned char *buf, int num);
+static void drbg_cleanup(void);
+static int drbg_add(const void *buf, int num, double add_entropy);
+static int drbg_status(void);
+
+static RAND_METHOD drbg_meth = {
+    drbg_seed_bytes,
+    drbg_bytes,
+    drbg_cleanup,
+    drbg_add,
+    drbg_bytes,
+    drbg_status
+};
+
+RAND_METHOD *RAND_CTR_DRBG(void)
+{
+    return &drbg_meth;
+}
+
+/* Add |n| to the 128 bit big-endian counter |V| */
+static void drbg_ctr_add(unsigned char *V, size_t n)
+{
+    int i;
+
+    for (i = DRBG_BLOCKLEN - 1; i >= 0 && n != 0; i--) {
+        n += V[i];
+        V[i] = (unsigned char)n;
+        n >>= 8;
+    }
+}
+
+/* Key the cipher with K and position the counter at V + 1 */
+static int drbg_ctr_init(DRBG_CTX *drbg)
+{
+    unsigned char iv[DRBG_BLOCKLEN];
+
+    memcpy(iv, drbg->V, sizeof(iv));
+    drbg_ctr_add(iv, 1);
+    return EVP_EncryptInit_ex(drbg->cipher, NULL, NULL, drbg->K, iv);
+}
+
+/*
+ * Write the encryptions of the next |len| / DRBG_BLOCKLEN counter values
+ * to |out| and advance V to match. |len| must be a multiple of the block
+ * size so the cipher stays aligned with V.
+ */
+static int drbg_ctr_blocks(DRBG_CTX *drbg, unsigned char *out, size_t len)
+{
+    int outl;
+
+    memset(out, 0, len);
+    if (!EVP_EncryptUpdate(drbg->cipher, out, &outl, out, (int)len))
+        return 0;
+    drbg_ctr_add(drbg->V, len / DRBG_BLOCKLEN);
+    return 1;
+}
+
+/*
+ * CTR_DRBG_Update with the cipher already positioned at V + 1. |in| is
+ * DRBG_SEEDLEN bytes of provided data or NULL for all zeroes.
+ */
+static int drbg_update_keyed(DRBG_CTX *drbg, const unsigned char *in)
+{
+    unsigned char tmp[DRBG_SEEDLEN];
+    int i;
+
+    if (!drbg_ctr_blocks(drbg, tmp, sizeof(tmp)))
+        return 0;
+    if (in != NULL)
+        for (i = 0; i < DRBG_SEEDLEN; i++)
+            tmp[i] ^= in[i];
+    memcpy(drbg->K, tmp, DRBG_KEYLEN);
+    memcpy(drbg->V, tmp + DRBG_KEYLEN, DRBG_BLOCKLEN);
+    OPENSSL_cleanse(tmp, sizeof(tmp));
+    return 1;
+}
+
+/* Instantiate or reseed |drbg| from DRBG_SEEDLEN bytes of |seed| */
+static int drbg_seed(DRBG_CTX *drbg, const unsigned char *seed)
+{
+    if (drbg->cipher == NULL) {
+        CRYPTO_mem_ctrl(CRYPTO_MEM_CHECK_DISABLE);
+        drbg->cipher = EVP_CIPHER_CTX_new();
+        if (drbg->cipher != NULL
+            && !EVP_EncryptInit_ex(drbg->cipher, EVP_aes_256_ctr(), NULL,
+                                   NULL, NULL)) {
+            EVP_CIPHER_CTX_free(drbg->cipher);
+            drbg->cipher = NULL;
+        }
+        CRYPTO_mem_ctrl(CRYPTO_MEM_CHECK_ENABLE);
+        if (drbg->cipher == NULL)
+            return 0;
+    }
+    if (!drbg->seeded) {
+        memset(drbg->K, 0, sizeof(drbg->K));
+        memset(drbg->V, 0, sizeof(drbg->V));
+    }
+    if (!drbg_ctr_init(drbg) || !drbg_update_keyed(drbg, seed)) {
+        drbg->seeded = 0;
+        return 0;
+    }
+    drbg->reseed_counter = 1;
+    drbg->seeded = 1;
+#ifndef GETPID_IS_MEANINGLESS
+    drbg->pid = getpid();
+#endif
+    return 1;
+}
+
+/* CTR_DRBG_Generate without additional input, |outlen| <= DRBG_MAX_REQUEST */
+static int drbg_generate(DRBG_CTX *drbg, unsigned char *out, size_t outlen)
+{
+    unsigned char tmp[DRBG_BLOCKLEN];
+    size_t full = outlen - outlen % DRBG_BLOCKLEN;
+
+    if (!drbg_ctr_init(drbg))
+        goto err;
+    if (full > 0 && !drbg_ctr_blocks(drbg, out, full))
+        goto err;
+    if (outlen > full) {
+        if (!drbg_ctr_blocks(drbg, tmp, sizeof(tmp)))
+            goto err;
+        memcpy(out + full, tmp, outlen - full);
+        OPENSSL_cleanse(tmp, sizeof(tmp));
+    }
+    /* The cipher now sits at V + 1, as the update step needs */
+    if (!drbg_update_keyed(drbg, NULL))
+        goto err;
+    drbg->reseed_counter++;
+    return 1;
+
+ err:
+    drbg->seeded = 0;
+    return 0;
+}
+
+/* Read drbg_reseed_gen into |gen| */
+static int drbg_get_gen(int *gen)
+{
+    return CRYPTO_atomic_add(&drbg_reseed_gen, 0, gen, drbg_gen_lock);
+}
+
+static int drbg_need_reseed(DRBG_CTX *drbg, unsigned int interval)
+{
+    int gen;
+
+    if (!drbg->seeded || drbg->reseed_counter > interval
+        || !drbg_get_gen(&gen) || drbg->gen != gen)
+        return 1;
+#ifndef GETPID_IS_MEANINGLESS
+    /* A forked child must not repeat its parent's output */
+    if (drbg->pid != getpid())
+        return 1;
+#endif
+    return 0;
+}
+
+/*
+ * Get DRBG_SEEDLEN bytes of seed material for the master: pool output with
+ * whatever the operating system can supply in one go XORed in.
+ */
+static int drbg_master_seed_material(unsigned char *seed)
+{
+    unsigned char os[DRBG_SEEDLEN];
+    int i, n;
+
+    if (RAND_OpenSSL()->bytes(seed, DRBG_SEEDLEN) <= 0)
+        return 0;
+    n = rand_os_bytes(os, sizeof(os));
+    for (i = 0; i < n; i++)
+        seed[i] ^= os[i];
+    OPENSSL_cleanse(os, sizeof(os));
+    return 1;
+}
+
+static void drbg_free(DRBG_CTX *drbg)
+{
+    EVP_CIPHER_CTX_free(drbg->cipher);
+    OPENSSL_cleanse(drbg, sizeof(*drbg));
+}
+
+static void drbg_thread_free(void *arg)
+{
+    DRBG_CTX *drbg = arg;
+
+    if (drbg == NULL)
+        return;
+    CRYPTO_mem_ctrl(CRYPTO_MEM_CHECK_DISABLE);
+    drbg_free(drbg);
+    OPENSSL_free(drbg);
+    CRYPTO_mem_ctrl(CRYPTO_MEM_CHECK_ENABLE);
+}
+
+static void drbg_init(void)
+{
+    drbg_key_ok = CRYPTO_THREAD_init_local(&drbg_key, drbg_thread_free);
+    /* Like the per-thread DRBGs this lives until the process exits */
+    CRYPTO_mem_ctrl(CRYPTO_MEM_CHECK_DISABLE);
+    drbg_gen_lock = CRYPTO_THREAD_lock_new();
+    CRYPTO_mem_ctrl(CRYPTO_MEM_CHECK_ENABLE);
+}
+
+/* Return the calling thread's child DRBG, creating it on first use */
+static DRBG_CTX *drbg_get(void)
+{
+    DRBG_CTX *drbg;
+
+    if (!CRYPTO_THREAD_run_once(&drbg_once, drbg_init) || !drbg_key_ok)
+        return NULL;
+    drbg = CRYPTO_THREAD_get_local(&drbg_key);
+    if (drbg != NULL)
+        return drbg;
+
+    CRYPTO_mem_ctrl(CRYPTO_MEM_CHECK_DISABLE);
+    drbg = OPENSSL_zalloc(sizeof(*drbg));
+    CRYPTO_mem_ctrl(CRYPTO_MEM_CHECK_ENABLE);
+    if (drbg == NULL)
+        return NULL;
+    if (!CRYPTO_THREAD_set_local(&drbg_key, drbg)) {
+        drbg_thread_free(drbg);
+        return NULL;
+    }
+    return drbg;
+}
+
+/* Reseed |drbg| from the master, reseeding the master first if needed */
+static int drbg_child_reseed(DRBG_CTX *drbg)
+{
+    unsigned char seed[DRBG_SEEDLEN];
+    int gen, ret = 0;
+
+    CRYPTO_w_lock(CRYPTO_LOCK_DRBG);
+    if (drbg_need_reseed(&drbg_master, DRBG_MASTER_RESEED_INTERVAL)) {
+        /*
+         * Sample the generation first: if RAND_add() runs while the pool
+         * is read we reseed once more rather than miss it.
+         */
+        if (!drbg_get_gen(&gen)
+            || !drbg_master_seed_material(seed)
+            || !drbg_seed(&drbg_master, seed)) {
+            CRYPTO_w_unlock(CRYPTO_LOCK_DRBG);
+            goto end;
+        }
+        drbg_master.gen = gen;
+    }
+    gen = drbg_master.gen;
+    if (!drbg_generate(&drbg_master, seed, sizeof(seed))) {
+        CRYPTO_w_unlock(CRYPTO_LOCK_DRBG);
+        goto end;
+    }
+    CRYPTO_w_unlock(CRYPTO_LOCK_DRBG);
+
+    if (drbg_seed(drbg, seed)) {
+        drbg->gen = gen;
+        ret = 1;
+    }
+ end:
+    OPENSSL_cleanse(seed, sizeof(seed));
+    return ret;
+}
+
+static int drbg_bytes(unsigned char *buf, int num)
+{
+    DRBG_CTX *drbg;
+    size_t n;
+
+#ifdef BN_DEBUG
+    if (rand_predictable)
+        return RAND_OpenSSL()->bytes(buf, num);
+#endif
+
+    if (num <= 0)
+        return 1;
+    if ((drbg = drbg_get()) == NULL) {
+        RANDerr(RAND_F_DRBG_BYTES, ERR_R_MALLOC_FAILURE);
+        return 0;
+    }
+    while (num > 0) {
+        if (drbg_need_reseed(drbg, DRBG_CHILD_RESEED_INTERVAL)
+            && !drbg_child_reseed(drbg)) {
+            RANDerr(RAND_F_DRBG_BYTES, RAND_R_PRNG_NOT_SEEDED);
+            return 0;
+        }
+        n = num > DRBG_MAX_REQUEST ? DRBG_MAX_REQUEST : (size_t)num;
+        if (!drbg_generate(drbg, buf, n)) {
+            RANDerr(RAND_F_DRBG_BYTES, RAND_R_PRNG_ERROR);
+            return 0;
+        }
+        buf += n;
+        num -= (int)n;
+    }
+    return 1;
+}
+
+static int drbg_add(const void *buf, int num, double add_entropy)
+{
+    const RAND_METHOD *pool = RAND_OpenSSL();
+    int gen;
+
+    if (!pool->add(buf, num, add_entropy))
+        return 0;
+    return CRYPTO_THREAD_run_once(&drbg_once, drbg_init)
+        && CRYPTO_atomic_add(&drbg_reseed_gen, 1, &gen, drbg_gen_lock);
+}
+
+static int drbg_seed_bytes(const void *buf, int num)
+{
+    return drbg_add(buf, num, (double)num);
+}
+
+static int drbg_status(void)
+{
+    return RAND_OpenSSL()->status();
+}
+
+static void drbg_cleanup(void)
+{
+    DRBG_CTX *drbg;
+
+    if (drbg_key_ok && (drbg = CRYPTO_THREAD_get_local(&drbg_key)) != NULL) {
+        CRYPTO_THREAD_set_local(&drbg_key, NULL);
+        drbg_thread_free(drbg);
+    }
+    CRYPTO_w_lock(CRYPTO_LOCK_DRBG);
+    drbg_free(&drbg_master);
+    CRYPTO_w_unlock(CRYPTO_LOCK_DRBG);
+    RAND_OpenSSL()->cleanup();
+}
@@ -144,5 +144,6 @@
 # endif
 
 void rand_hw_xor(unsigned char *buf, size_t num);
+int rand_os_bytes(unsigned char *buf, int len);
 
 #endif
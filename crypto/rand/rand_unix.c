@@ -239,27 +239,62 @@ int RAND_poll(void)
 
     return 1;
 }
+
+int rand_os_bytes(unsigned char *buf, int len)
+{
+    arc4random_buf(buf, len);
+    return len;
+}
+#  define HAVE_RAND_OS_BYTES
+
 # else                          /* !defined(__OpenBSD__) */
-int RAND_poll(void)
+
+#  if defined(OPENSSL_SYS_LINUX)
+#   include <sys/syscall.h>
+#   ifdef SYS_getrandom
+#    define OPENSSL_HAVE_GETRANDOM
+#    ifndef GRND_NONBLOCK
+#     define GRND_NONBLOCK 0x0001
+#    endif
+#   endif
+#  endif
+
+#  ifdef OPENSSL_HAVE_GETRANDOM
+/* Cleared the first time the kernel reports getrandom() as unsupported */
+static int have_getrandom = 1;
+
+/*
+ * Read up to |len| bytes with getrandom(2), which needs no file descriptor.
+ * Rather than block until the kernel pool is initialised we return short
+ * and let the caller fall back to the devices.
+ */
+static int rand_getrandom(unsigned char *buf, int len)
 {
-    unsigned long l;
-    pid_t curr_pid = getpid();
-#  if defined(DEVRANDOM) || (!defined(OPENSS_NO_EGD) && defined(DEVRANDOM_EGD))
-    unsigned char tmpbuf[ENTROPY_NEEDED];
     int n = 0;
+    long r;
+
+    while (have_getrandom && n < len) {
+        r = syscall(SYS_getrandom, buf + n, (size_t)(len - n), GRND_NONBLOCK);
+        if (r > 0)
+            n += (int)r;
+        else if (r < 0 && errno == ENOSYS)
+            have_getrandom = 0;
+        else if (r == 0 || errno != EINTR)
+            break;
+    }
+    return n;
+}
 #  endif
+
 #  ifdef DEVRANDOM
+/* Read up to |len| bytes from the first DEVRANDOM devices that respond */
+static int rand_dev_bytes(unsigned char *buf, int len)
+{
     static const char *randomfiles[] = { DEVRANDOM };
     struct stat randomstats[OSSL_NELEM(randomfiles)];
-    int fd;
+    int fd, n = 0;
     unsigned int i;
-#  endif
-#  if !defined(OPENSSL_NO_EGD) && defined(DEVRANDOM_EGD)
-    static const char *egdsockets[] = { DEVRANDOM_EGD, NULL };
-    const char **egdsocket = NULL;
-#  endif
 
-#  ifdef DEVRANDOM
     memset(randomstats, 0, sizeof(randomstats));
     /*
      * Use a random entropy pool device. Linux, FreeBSD and OpenBSD have
@@ -267,7 +302,7 @@ int RAND_poll(void)
      * out of random entries.
      */
 
-    for (i = 0; (i < OSSL_NELEM(randomfiles)) && (n < ENTROPY_NEEDED); i++) {
+    for (i = 0; (i < OSSL_NELEM(randomfiles)) && (n < len); i++) {
         if ((fd = open(randomfiles[i], O_RDONLY
 #   ifdef O_NONBLOCK
                        | O_NONBLOCK
@@ -346,8 +381,7 @@ int RAND_poll(void)
 #   endif
 
                 if (try_read) {
-                    r = read(fd, (unsigned char *)tmpbuf + n,
-                             ENTROPY_NEEDED - n);
+                    r = read(fd, buf + n, len - n);
                     if (r > 0)
                         n += r;
                 } else
@@ -364,12 +398,47 @@ int RAND_poll(void)
             }
             while ((r > 0 ||
                     (errno == EINTR || errno == EAGAIN)) && usec != 0
-                   && n < ENTROPY_NEEDED);
+                   && n < len);
 
             close(fd);
         }
     }
-#  endif                        /* defined(DEVRANDOM) */
+    return n;
+}
+#  endif
+
+/*
+ * Fill |buf| with up to |len| bytes of entropy from the operating system,
+ * preferring getrandom() over opening the DEVRANDOM devices. Returns the
+ * number of bytes obtained.
+ */
+int rand_os_bytes(unsigned char *buf, int len)
+{
+    int n = 0;
+
+#  ifdef OPENSSL_HAVE_GETRANDOM
+    n = rand_getrandom(buf, len);
+#  endif
+#  ifdef DEVRANDOM
+    if (n < len)
+        n += rand_dev_bytes(buf + n, len - n);
+#  endif
+    return n;
+}
+#  define HAVE_RAND_OS_BYTES
+
+int RAND_poll(void)
+{
+    unsigned long l;
+    pid_t curr_pid = getpid();
+    unsigned char tmpbuf[ENTROPY_NEEDED];
+    int n;
+#  if !defined(OPENSSL_NO_EGD) && defined(DEVRANDOM_EGD)
+    static const char *egdsockets[] = { DEVRANDOM_EGD, NULL };
+    const char **egdsocket = NULL;
+#  endif
+
+    n = rand_os_bytes(tmpbuf, ENTROPY_NEEDED);
 
 #  if !defined(OPENSSL_NO_EGD) && defined(DEVRANDOM_EGD)
     /*
@@ -388,12 +457,10 @@ int RAND_poll(void)
     }
 #  endif                        /* defined(DEVRANDOM_EGD) */
 
-#  if defined(DEVRANDOM) || (!defined(OPENSSL_NO_EGD) && defined(DEVRANDOM_EGD))
     if (n > 0) {
         RAND_add(tmpbuf, sizeof tmpbuf, (double)n);
         OPENSSL_cleanse(tmpbuf, n);
     }
-#  endif
 
     /* put in some default random data, we need more than just this */
     l = curr_pid;
@@ -404,7 +471,8 @@ int RAND_poll(void)
     l = time(NULL);
     RAND_add(&l, sizeof(l), 0.0);
 
-#  if defined(DEVRANDOM) || (!defined(OPENSSL_NO_EGD) && defined(DEVRANDOM_EGD))
+#  if defined(OPENSSL_HAVE_GETRANDOM) || defined(DEVRANDOM) \
+    || (!defined(OPENSSL_NO_EGD) && defined(DEVRANDOM_EGD))
     return 1;
 #  else
     return 0;
@@ -425,3 +493,10 @@ int RAND_poll(void)
     return 0;
 }
 #endif
+
+#ifndef HAVE_RAND_OS_BYTES
+int rand_os_bytes(unsigned char *buf, int len)
+{
+    return 0;
+}
+#endif
@@ -64,6 +64,7 @@
 #include <openssl/x509.h>
 #include <openssl/x509v3.h>
 #include "internal/x509_int.h"
+#include "x509_lcl.h"
 
 int X509_issuer_and_serial_cmp(const X509 *a, const X509 *b)
 {
@@ -176,12 +177,34 @@ unsigned long X509_subject_name_hash_old(X509 *x)
  * certain cert information is cached. So this is the point where the
  * "depth-first" constification tree has to halt with an evil cast.
  */
+/*
+ * The SHA-1 fingerprint is only needed when certificates are compared so
+ * compute it on first use instead of every time extensions are cached.
+ * EXFLAG_SHA1 is only set, under the X509 lock, once the digest succeeded;
+ * after a failure the next comparison tries again.
+ */
+static void x509_cache_sha1(X509 *x)
+{
+    int done;
+
+    CRYPTO_THREAD_read_lock(x->lock);
+    done = (x->ex_flags & EXFLAG_SHA1) != 0;
+    CRYPTO_THREAD_unlock(x->lock);
+    if (done)
+        return;
+    CRYPTO_THREAD_write_lock(x->lock);
+    if (!(x->ex_flags & EXFLAG_SHA1)
+        && X509_digest(x, EVP_sha1(), x->sha1_hash, NULL))
+        x->ex_flags |= EXFLAG_SHA1;
+    CRYPTO_THREAD_unlock(x->lock);
+}
+
 int X509_cmp(const X509 *a, const X509 *b)
 {
     int rv;
     /* ensure hash is valid */
-    X509_check_purpose((X509 *)a, -1, 0);
-    X509_check_purpose((X509 *)b, -1, 0);
+    x509_cache_sha1((X509 *)a);
+    x509_cache_sha1((X509 *)b);
 
     rv = memcmp(a->sha1_hash, b->sha1_hash, SHA_DIGEST_LENGTH);
     if (rv)
@@ -224,6 +247,44 @@ int X509_NAME_cmp(const X509_NAME *a, const X509_NAME *b)
 
 }
 
+/*
+ * Compare names for internal lookup tables. Names are ordered by the fast
+ * hash of their canonical encoding first so most comparisons never touch the
+ * encoding itself. The order differs from X509_NAME_cmp() but names are equal
+ * under one if and only if they are equal under the other.
+ */
+int x509_name_lookup_cmp(const X509_NAME *a, const X509_NAME *b)
+{
+    /* Ensure canonical encoding and its hash are up to date */
+    if (a->modified && i2d_X509_NAME((X509_NAME *)a, NULL) < 0)
+        return -2;
+    if (b->modified && i2d_X509_NAME((X509_NAME *)b, NULL) < 0)
+        return -2;
+    if (a->canon_hash != b->canon_hash)
+        return a->canon_hash < b->canon_hash ? -1 : 1;
+    return X509_NAME_cmp(a, b);
+}
+
+/*
+ * The hashes cached in an X509_NAME are published with CRYPTO_atomic_add():
+ * a thread that sees the flag set also sees the value stored before it.
+ * Where there are no atomics the flag cannot be read without a lock, and
+ * nothing is cached.
+ */
+static int x509_name_hash_cached(int *set)
+{
+    int ret;
+
+    return CRYPTO_atomic_add(set, 0, &ret, NULL) && ret > 0;
+}
+
+static void x509_name_hash_publish(int *set)
+{
+    int ret;
+
+    CRYPTO_atomic_add(set, 1, &ret, NULL);
+}
+
 unsigned long X509_NAME_hash(X509_NAME *x)
 {
     unsigned long ret = 0;
@@ -231,6 +292,8 @@ unsigned long X509_NAME_hash(X509_NAME *x)
 
     /* Make sure X509_NAME structure contains valid cached encoding */
     i2d_X509_NAME(x, NULL);
+    if (x509_name_hash_cached(&x->hash_set))
+        return x->hash;
     if (!EVP_Digest(x->canon_enc, x->canon_enclen, md, NULL, EVP_sha1(),
                     NULL))
         return 0;
@@ -238,6 +301,8 @@ unsigned long X509_NAME_hash(X509_NAME *x)
     ret = (((unsigned long)md[0]) | ((unsigned long)md[1] << 8L) |
            ((unsigned long)md[2] << 16L) | ((unsigned long)md[3] << 24L)
         ) & 0xffffffffL;
+    x->hash = ret;
+    x509_name_hash_publish(&x->hash_set);
     return (ret);
 }
 
@@ -249,22 +314,27 @@ unsigned long X509_NAME_hash(X509_NAME *x)
 
 unsigned long X509_NAME_hash_old(X509_NAME *x)
 {
-    EVP_MD_CTX *md_ctx = EVP_MD_CTX_new();
+    EVP_MD_CTX *md_ctx;
     unsigned long ret = 0;
     unsigned char md[16];
 
-    if (md_ctx == NULL)
-        return ret;
-
     /* Make sure X509_NAME structure contains valid cached encoding */
     i2d_X509_NAME(x, NULL);
+    if (x509_name_hash_cached(&x->hash_old_set))
+        return x->hash_old;
+    md_ctx = EVP_MD_CTX_new();
+    if (md_ctx == NULL)
+        return ret;
     EVP_MD_CTX_set_flags(md_ctx, EVP_MD_CTX_FLAG_NON_FIPS_ALLOW);
     if (EVP_DigestInit_ex(md_ctx, EVP_md5(), NULL)
         && EVP_DigestUpdate(md_ctx, x->bytes->data, x->bytes->length)
-        && EVP_DigestFinal_ex(md_ctx, md, NULL))
+        && EVP_DigestFinal_ex(md_ctx, md, NULL)) {
         ret = (((unsigned long)md[0]) | ((unsigned long)md[1] << 8L) |
                ((unsigned long)md[2] << 16L) | ((unsigned long)md[3] << 24L)
             ) & 0xffffffffL;
+        x->hash_old = ret;
+        x509_name_hash_publish(&x->hash_old_set);
+    }
     EVP_MD_CTX_free(md_ctx);
 
     return (ret);
@@ -165,10 +165,12 @@ static int x509_object_cmp(const X509_OBJECT *const *a,
         return ret;
     switch ((*a)->type) {
     case X509_LU_X509:
-        ret = X509_subject_name_cmp((*a)->data.x509, (*b)->data.x509);
+        ret = x509_name_lookup_cmp(X509_get_subject_name((*a)->data.x509),
+                                   X509_get_subject_name((*b)->data.x509));
         break;
     case X509_LU_CRL:
-        ret = X509_CRL_cmp((*a)->data.crl, (*b)->data.crl);
+        ret = x509_name_lookup_cmp(X509_CRL_get_issuer((*a)->data.crl),
+                                   X509_CRL_get_issuer((*b)->data.crl));
         break;
     default:
         /* abort(); */
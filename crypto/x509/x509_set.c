@@ -149,7 +149,9 @@ int X509_set_pubkey(X509 *x, EVP_PKEY *pkey)
 
 void X509_up_ref(X509 *x)
 {
-    CRYPTO_add(&x->references, 1, CRYPTO_LOCK_X509);
+    int i;
+
+    CRYPTO_atomic_add(&x->references, 1, &i, x->lock);
 }
 
 long X509_get_version(X509 *x)
@@ -89,15 +89,10 @@ int X509_CRL_set_lastUpdate(X509_CRL *x, const ASN1_TIME *tm)
 
     if (x == NULL)
         return (0);
-    in = x->crl.lastUpdate;
-    if (in != tm) {
-        in = ASN1_STRING_dup(tm);
-        if (in != NULL) {
-            ASN1_TIME_free(x->crl.lastUpdate);
-            x->crl.lastUpdate = in;
-        }
-    }
-    return (in != NULL);
+    in = &x->crl.lastUpdate;
+    if (in != tm)
+        return ASN1_STRING_copy(in, tm);
+    return 1;
 }
 
 int X509_CRL_set_nextUpdate(X509_CRL *x, const ASN1_TIME *tm)
@@ -135,7 +130,9 @@ int X509_CRL_sort(X509_CRL *c)
 
 void X509_CRL_up_ref(X509_CRL *crl)
 {
-    CRYPTO_add(&crl->references, 1, CRYPTO_LOCK_X509_CRL);
+    int i;
+
+    CRYPTO_atomic_add(&crl->references, 1, &i, crl->lock);
 }
 
 long X509_CRL_get_version(X509_CRL *crl)
@@ -145,7 +142,7 @@ long X509_CRL_get_version(X509_CRL *crl)
 
 ASN1_TIME *X509_CRL_get_lastUpdate(X509_CRL *crl)
 {
-    return crl->crl.lastUpdate;
+    return &crl->crl.lastUpdate;
 }
 
 ASN1_TIME *X509_CRL_get_nextUpdate(X509_CRL *crl)
@@ -184,7 +181,7 @@ int X509_CRL_get_signature_nid(const X509_CRL *crl)
 
 ASN1_TIME *X509_REVOKED_get0_revocationDate(X509_REVOKED *x)
 {
-    return x->revocationDate;
+    return &x->revocationDate;
 }
 
 int X509_REVOKED_set_revocationDate(X509_REVOKED *x, ASN1_TIME *tm)
@@ -193,15 +190,10 @@ int X509_REVOKED_set_revocationDate(X509_REVOKED *x, ASN1_TIME *tm)
 
     if (x == NULL)
         return (0);
-    in = x->revocationDate;
-    if (in != tm) {
-        in = ASN1_STRING_dup(tm);
-        if (in != NULL) {
-            ASN1_TIME_free(x->revocationDate);
-            x->revocationDate = in;
-        }
-    }
-    return (in != NULL);
+    in = &x->revocationDate;
+    if (in != tm)
+        return ASN1_STRING_copy(in, tm);
+    return 1;
 }
 
 ASN1_INTEGER *X509_REVOKED_get0_serialNumber(X509_REVOKED *x)
@@ -67,10 +67,11 @@
 static int X509_REVOKED_cmp(const X509_REVOKED *const *a,
                             const X509_REVOKED *const *b);
 static void setup_idp(X509_CRL *crl, ISSUING_DIST_POINT *idp);
+static void crl_revoked_idx_free(X509_CRL *crl);
 
 ASN1_SEQUENCE(X509_REVOKED) = {
         ASN1_EMBED(X509_REVOKED,serialNumber, ASN1_INTEGER),
-        ASN1_SIMPLE(X509_REVOKED,revocationDate, ASN1_TIME),
+        ASN1_EMBED(X509_REVOKED,revocationDate, ASN1_TIME),
         ASN1_SEQUENCE_OF_OPT(X509_REVOKED,extensions, X509_EXTENSION)
 } ASN1_SEQUENCE_END(X509_REVOKED)
 
@@ -117,7 +118,7 @@ ASN1_SEQUENCE_enc(X509_CRL_INFO, enc, crl_inf_cb) = {
         ASN1_OPT(X509_CRL_INFO, version, ASN1_INTEGER),
         ASN1_EMBED(X509_CRL_INFO, sig_alg, X509_ALGOR),
         ASN1_SIMPLE(X509_CRL_INFO, issuer, X509_NAME),
-        ASN1_SIMPLE(X509_CRL_INFO, lastUpdate, ASN1_TIME),
+        ASN1_EMBED(X509_CRL_INFO, lastUpdate, ASN1_TIME),
         ASN1_OPT(X509_CRL_INFO, nextUpdate, ASN1_TIME),
         ASN1_SEQUENCE_OF_OPT(X509_CRL_INFO, revoked, X509_REVOKED),
         ASN1_EXP_SEQUENCE_OF_OPT(X509_CRL_INFO, extensions, X509_EXTENSION, 0)
@@ -218,6 +219,9 @@ static int crl_cb(int operation, ASN1_VALUE **pval, const ASN1_ITEM *it,
         crl->issuers = NULL;
         crl->crl_number = NULL;
         crl->base_crl_number = NULL;
+        crl->revoked_idx = NULL;
+        crl->revoked_idx_mask = 0;
+        crl->revoked_idx_num = 0;
         break;
 
     case ASN1_OP_D2I_POST:
@@ -287,6 +291,7 @@ static int crl_cb(int operation, ASN1_VALUE **pval, const ASN1_ITEM *it,
         ASN1_INTEGER_free(crl->crl_number);
         ASN1_INTEGER_free(crl->base_crl_number);
         sk_GENERAL_NAMES_pop_free(crl->issuers, GENERAL_NAMES_free);
+        crl_revoked_idx_free(crl);
         break;
     }
     return 1;
@@ -330,7 +335,7 @@ static void setup_idp(X509_CRL *crl, ISSUING_DIST_POINT *idp)
     DIST_POINT_set_dpname(idp->distpoint, X509_CRL_get_issuer(crl));
 }
 
-ASN1_SEQUENCE_ref(X509_CRL, crl_cb, CRYPTO_LOCK_X509_CRL) = {
+ASN1_SEQUENCE_ref(X509_CRL, crl_cb) = {
         ASN1_EMBED(X509_CRL, crl, X509_CRL_INFO),
         ASN1_EMBED(X509_CRL, sig_alg, X509_ALGOR),
         ASN1_EMBED(X509_CRL, signature, ASN1_BIT_STRING)
@@ -364,6 +369,9 @@ int X509_CRL_add0_revoked(X509_CRL *crl, X509_REVOKED *rev)
         return 0;
     }
     inf->enc.modified = 1;
+    CRYPTO_THREAD_write_lock(crl->lock);
+    crl_revoked_idx_free(crl);
+    CRYPTO_THREAD_unlock(crl->lock);
     return 1;
 }
 
@@ -424,21 +432,131 @@ static int crl_revoked_issuer_match(X509_CRL *crl, X509_NAME *nm,
 
 }
 
+/*
+ * Revoked entry index. Large CRLs can have hundreds of thousands of entries
+ * so instead of sorting and performing a binary search for every lookup we
+ * build an open addressed hash table of the entries, keyed on serial number,
+ * the first time the CRL is queried.
+ */
+
+static size_t crl_serial_hash(const ASN1_INTEGER *serial)
+{
+    size_t h = 2166136261U;
+    int i;
+
+    for (i = 0; i < serial->length; i++) {
+        h ^= serial->data[i];
+        h *= 16777619U;
+    }
+    return h;
+}
+
+static void crl_revoked_idx_free(X509_CRL *crl)
+{
+    OPENSSL_free(crl->revoked_idx);
+    crl->revoked_idx = NULL;
+    crl->revoked_idx_mask = 0;
+    crl->revoked_idx_num = 0;
+}
+
+/*
+ * Build the index if it is absent or stale. Called with the CRL write lock
+ * held so only one thread ever builds it. Returns zero if the index could
+ * not be allocated: the caller then falls back to searching the sorted
+ * stack.
+ */
+static int crl_revoked_idx_build(X509_CRL *crl)
+{
+    STACK_OF(X509_REVOKED) *revoked = crl->crl.revoked;
+    X509_REVOKED **idx;
+    size_t nslots = 16, mask, h;
+    int i, num = sk_X509_REVOKED_num(revoked);
+
+    if (crl->revoked_idx != NULL && crl->revoked_idx_num == num)
+        return 1;
+    crl_revoked_idx_free(crl);
+    /* Keep the load factor at or below one half */
+    while (nslots < (size_t)num * 2)
+        nslots <<= 1;
+    idx = OPENSSL_zalloc(nslots * sizeof(*idx));
+    if (idx == NULL)
+        return 0;
+    mask = nslots - 1;
+    for (i = 0; i < num; i++) {
+        X509_REVOKED *rev = sk_X509_REVOKED_value(revoked, i);
+
+        h = crl_serial_hash(&rev->serialNumber) & mask;
+        while (idx[h] != NULL)
+            h = (h + 1) & mask;
+        idx[h] = rev;
+    }
+    crl->revoked_idx_mask = mask;
+    crl->revoked_idx_num = num;
+    crl->revoked_idx = idx;
+    return 1;
+}
+
+static int crl_revoked_found(X509_REVOKED *rev, X509_REVOKED **ret)
+{
+    if (ret)
+        *ret = rev;
+    if (rev->reason == CRL_REASON_REMOVE_FROM_CRL)
+        return 2;
+    return 1;
+}
+
 static int def_crl_lookup(X509_CRL *crl,
                           X509_REVOKED **ret, ASN1_INTEGER *serial,
                           X509_NAME *issuer)
 {
     X509_REVOKED rtmp, *rev;
+    size_t h;
     int idx;
+
+    if (crl->crl.revoked == NULL)
+        return 0;
+    /*
+     * The index is only read under the CRL lock: X509_CRL_add0_revoked()
+     * frees it under the write lock.
+     */
+    CRYPTO_THREAD_read_lock(crl->lock);
+    if (crl->revoked_idx == NULL
+        || crl->revoked_idx_num != sk_X509_REVOKED_num(crl->crl.revoked)) {
+        CRYPTO_THREAD_unlock(crl->lock);
+        CRYPTO_THREAD_write_lock(crl->lock);
+        crl_revoked_idx_build(crl);
+    }
+    if (crl->revoked_idx != NULL) {
+        int found = 0;
+
+        /*
+         * Entries with the same serial number (possible in indirect CRLs)
+         * all live in the same probe sequence, check each for an issuer
+         * match.
+         */
+        h = crl_serial_hash(serial) & crl->revoked_idx_mask;
+        while ((rev = crl->revoked_idx[h]) != NULL) {
+            if (!ASN1_INTEGER_cmp(&rev->serialNumber, serial)
+                && crl_revoked_issuer_match(crl, issuer, rev)) {
+                found = 1;
+                break;
+            }
+            h = (h + 1) & crl->revoked_idx_mask;
+        }
+        CRYPTO_THREAD_unlock(crl->lock);
+        return found ? crl_revoked_found(rev, ret) : 0;
+    }
+    CRYPTO_THREAD_unlock(crl->lock);
+
     rtmp.serialNumber = *serial;
     /*
      * Sort revoked into serial number order if not already sorted. Do this
      * under a lock to avoid race condition.
      */
     if (!sk_X509_REVOKED_is_sorted(crl->crl.revoked)) {
-        CRYPTO_w_lock(CRYPTO_LOCK_X509_CRL);
+        CRYPTO_THREAD_write_lock(crl->lock);
         sk_X509_REVOKED_sort(crl->crl.revoked);
-        CRYPTO_w_unlock(CRYPTO_LOCK_X509_CRL);
+        CRYPTO_THREAD_unlock(crl->lock);
     }
     idx = sk_X509_REVOKED_find(crl->crl.revoked, &rtmp);
     if (idx < 0)
@@ -448,13 +566,8 @@ static int def_crl_lookup(X509_CRL *crl,
         rev = sk_X509_REVOKED_value(crl->crl.revoked, idx);
         if (ASN1_INTEGER_cmp(&rev->serialNumber, serial))
             return 0;
-        if (crl_revoked_issuer_match(crl, issuer, rev)) {
-            if (ret)
-                *ret = rev;
-            if (rev->reason == CRL_REASON_REMOVE_FROM_CRL)
-                return 2;
-            return 1;
-        }
+        if (crl_revoked_issuer_match(crl, issuer, rev))
+            return crl_revoked_found(rev, ret);
     }
     return 0;
 }
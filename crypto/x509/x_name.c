@@ -302,6 +302,7 @@ static int x509_name_encode(X509_NAME *a)
     sk_STACK_OF_X509_NAME_ENTRY_pop_free(intname.s,
                                          local_sk_X509_NAME_ENTRY_free);
     a->modified = 0;
+    a->hash_old_set = 0;
     return len;
  memerr:
     sk_STACK_OF_X509_NAME_ENTRY_pop_free(intname.s,
@@ -330,6 +331,19 @@ static int x509_name_ex_print(BIO *out, ASN1_VALUE **pval,
  * constraints of type dirName can also be checked with a simple memcmp().
  */
 
+/* 64 bit FNV-1a hash of the canonical encoding */
+
+static uint64_t x509_name_canon_hash(const unsigned char *p, int len)
+{
+    uint64_t h = 0xcbf29ce484222325ULL;
+
+    while (len-- > 0) {
+        h ^= *p++;
+        h *= 0x100000001b3ULL;
+    }
+    return h;
+}
+
 static int x509_name_canon(X509_NAME *a)
 {
     unsigned char *p;
@@ -340,9 +354,11 @@ static int x509_name_canon(X509_NAME *a)
 
     OPENSSL_free(a->canon_enc);
     a->canon_enc = NULL;
+    a->hash_set = 0;
     /* Special case: empty X509_NAME => null encoding */
     if (sk_X509_NAME_ENTRY_num(a->entries) == 0) {
         a->canon_enclen = 0;
+        a->canon_hash = x509_name_canon_hash(NULL, 0);
         return 1;
     }
     intname = sk_STACK_OF_X509_NAME_ENTRY_new_null();
@@ -382,6 +398,8 @@ static int x509_name_canon(X509_NAME *a)
 
     i2d_name_canon(intname, &p);
 
+    a->canon_hash = x509_name_canon_hash(a->canon_enc, a->canon_enclen);
+
     ret = 1;
 
  err:
@@ -72,6 +72,7 @@ static ERR_STRING_DATA DASYNC_str_functs[]=
 	{
 {ERR_FUNC(DASYNC_F_BIND_DASYNC),	"BIND_DASYNC"},
 {ERR_FUNC(DASYNC_F_CIPHER_AES_128_CBC_CODE),	"CIPHER_AES_128_CBC_CODE"},
+{ERR_FUNC(DASYNC_F_DASYNC_CIPHER_INIT_KEY_HELPER),	"DASYNC_CIPHER_INIT_KEY_HELPER"},
 {ERR_FUNC(DASYNC_F_DASYNC_BN_MOD_EXP),	"DASYNC_BN_MOD_EXP"},
 {ERR_FUNC(DASYNC_F_DASYNC_MOD_EXP),	"DASYNC_MOD_EXP"},
 {ERR_FUNC(DASYNC_F_DASYNC_PRIVATE_DECRYPT),	"DASYNC_PRIVATE_DECRYPT"},
@@ -73,6 +73,7 @@ static void ERR_DASYNC_error(int function, int reason, char *file, int line);
 /* Function codes. */
 #define DASYNC_F_BIND_DASYNC				 107
 #define DASYNC_F_CIPHER_AES_128_CBC_CODE		 100
+#define DASYNC_F_DASYNC_CIPHER_INIT_KEY_HELPER		 108
 #define DASYNC_F_DASYNC_BN_MOD_EXP			 101
 #define DASYNC_F_DASYNC_MOD_EXP				 102
 #define DASYNC_F_DASYNC_PRIVATE_DECRYPT			 103
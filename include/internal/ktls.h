@@ -0,0 +1,247 @@
+/* ====================================================================
+ * Copyright (c) 2016 The OpenSSL Project.  All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * 3. All advertising materials mentioning features or use of this
+ *    software must display the following acknowledgment:
+ *    "This product includes software developed by the OpenSSL Project
+ *    for use in the OpenSSL Toolkit. (http://www.openssl.org/)"
+ *
+ * 4. The names "OpenSSL Toolkit" and "OpenSSL Project" must not be used to
+ *    endorse or promote products derived from this software without
+ *    prior written permission. For written permission, please contact
+ *    openssl-core@openssl.org.
+ *
+ * 5. Products derived from this software may not be called "OpenSSL"
+ *    nor may "OpenSSL" appear in their names without prior written
+ *    permission of the OpenSSL Project.
+ *
+ * 6. Redistributions of any form whatsoever must retain the following
+ *    acknowledgment:
+ *    "This product includes software developed by the OpenSSL Project
+ *    for use in the OpenSSL Toolkit (http://www.openssl.org/)"
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE OpenSSL PROJECT ``AS IS'' AND ANY
+ * EXPRESSED OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE OpenSSL PROJECT OR
+ * ITS CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT
+ * NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ * ====================================================================
+ *
+ * This product includes cryptographic software written by Eric Young
+ * (eay@cryptsoft.com).  This product includes software written by Tim
+ * Hudson (tjh@cryptsoft.com).
+ *
+ */
+
+/*
+ * Kernel TLS: once the handshake is done the kernel can encrypt and frame
+ * the records itself, so that data written to the socket, including with
+ * sendfile(), goes out as TLS records. It can likewise decrypt the records
+ * read from the socket and hand back just their contents.
+ */
+
+#ifndef HEADER_INTERNAL_KTLS_H
+# define HEADER_INTERNAL_KTLS_H
+
+# include <openssl/e_os2.h>
+
+# ifndef OPENSSL_NO_KTLS
+#  if !defined(__linux__)
+#   define OPENSSL_NO_KTLS
+#  else
+#   include <linux/version.h>
+#   if LINUX_VERSION_CODE < KERNEL_VERSION(4, 13, 0)
+#    define OPENSSL_NO_KTLS
+#   else
+#    include <linux/tls.h>
+/* The kernel version alone does not tell whether the headers have it */
+#    ifndef TLS_TX
+#     define OPENSSL_NO_KTLS
+#    endif
+#   endif
+#  endif
+# endif
+
+# ifndef OPENSSL_NO_KTLS
+#  include <errno.h>
+#  include <string.h>
+#  include <sys/types.h>
+#  include <sys/socket.h>
+#  include <sys/sendfile.h>
+#  include <netinet/in.h>
+#  include <netinet/tcp.h>
+
+#  ifndef SOL_TLS
+#   define SOL_TLS 282
+#  endif
+#  ifndef TCP_ULP
+#   define TCP_ULP 31
+#  endif
+/*
+ * Older kernels only do the sending side and reject TLS_RX, and older headers
+ * lack the record type control messages
+ */
+#  ifndef TLS_RX
+#   define TLS_RX 2
+#  endif
+#  ifndef TLS_SET_RECORD_TYPE
+#   define TLS_SET_RECORD_TYPE 1
+#  endif
+#  ifndef TLS_GET_RECORD_TYPE
+#   define TLS_GET_RECORD_TYPE 2
+#  endif
+
+/* The record header ktls_read_record() puts before each record's contents */
+#  define KTLS_RECORD_HEADER_LENGTH 5
+#  define KTLS_MAX_PLAIN_LENGTH     16384
+/* Its version, TLS 1.2: the kernel only does TLS 1.2 */
+#  define KTLS_RECORD_VERSION_MAJOR 0x03
+#  define KTLS_RECORD_VERSION_MINOR 0x03
+
+/* The key material for one direction, as the kernel takes it */
+typedef struct ktls_crypto_info_st {
+    union {
+        struct tls_crypto_info info;
+        struct tls12_crypto_info_aes_gcm_128 gcm128;
+#  ifdef TLS_CIPHER_AES_GCM_256
+        struct tls12_crypto_info_aes_gcm_256 gcm256;
+#  endif
+    } u;
+    size_t len;
+} KTLS_CRYPTO_INFO;
+
+/*
+ * Attach the "tls" upper layer protocol to the TCP socket |fd|, unless it
+ * already is for the other direction. This fails if the kernel lacks TLS
+ * support, in which case nothing changes.
+ */
+static ossl_inline int ktls_enable(int fd)
+{
+    return setsockopt(fd, SOL_TCP, TCP_ULP, "tls", sizeof("tls")) == 0
+           || errno == EEXIST;
+}
+
+/* Hand the keys for sending (|is_tx| != 0) or receiving to the kernel */
+static ossl_inline int ktls_start(int fd, const KTLS_CRYPTO_INFO *ci,
+                                  int is_tx)
+{
+    return setsockopt(fd, SOL_TLS, is_tx ? TLS_TX : TLS_RX,
+                      &ci->u, ci->len) == 0;
+}
+
+/*
+ * Send |length| bytes as a record of |record_type|, which the kernel
+ * otherwise takes to be application data.
+ */
+static ossl_inline int ktls_send_ctrl_message(int fd,
+                                              unsigned char record_type,
+                                              const void *data, size_t length)
+{
+    struct msghdr msg;
+    struct cmsghdr *cmsg;
+    struct iovec msg_iov;
+    char buf[CMSG_SPACE(sizeof(record_type))];
+
+    memset(&msg, 0, sizeof(msg));
+    memset(buf, 0, sizeof(buf));
+    msg.msg_control = buf;
+    msg.msg_controllen = sizeof(buf);
+    cmsg = CMSG_FIRSTHDR(&msg);
+    cmsg->cmsg_level = SOL_TLS;
+    cmsg->cmsg_type = TLS_SET_RECORD_TYPE;
+    cmsg->cmsg_len = CMSG_LEN(sizeof(record_type));
+    *((unsigned char *)CMSG_DATA(cmsg)) = record_type;
+    msg.msg_controllen = cmsg->cmsg_len;
+
+    msg_iov.iov_base = (void *)data;
+    msg_iov.iov_len = length;
+    msg.msg_iov = &msg_iov;
+    msg.msg_iovlen = 1;
+
+    return sendmsg(fd, &msg, 0);
+}
+
+/*
+ * Read the next record that the kernel has decrypted into |data|, which
+ * holds |length| bytes. The record is returned as if it had been sent in
+ * the clear: a TLS 1.2 record header with the type the kernel reports,
+ * followed by the contents. Returns the number of bytes written to |data|,
+ * 0 at the end of the stream, or -1 with errno set. EBADMSG means the record
+ * did not decrypt.
+ */
+static ossl_inline int ktls_read_record(int fd, void *data, size_t length)
+{
+    struct msghdr msg;
+    struct cmsghdr *cmsg;
+    struct iovec msg_iov;
+    union {
+        struct cmsghdr hdr;
+        char buf[CMSG_SPACE(sizeof(unsigned char))];
+    } cmsgbuf;
+    unsigned char *p = data;
+    int ret;
+
+    if (length <= KTLS_RECORD_HEADER_LENGTH) {
+        errno = EINVAL;
+        return -1;
+    }
+    length -= KTLS_RECORD_HEADER_LENGTH;
+    /* Records of the same type may be merged, which must not overflow one */
+    if (length > KTLS_MAX_PLAIN_LENGTH)
+        length = KTLS_MAX_PLAIN_LENGTH;
+
+    memset(&msg, 0, sizeof(msg));
+    msg.msg_control = cmsgbuf.buf;
+    msg.msg_controllen = sizeof(cmsgbuf.buf);
+    msg_iov.iov_base = p + KTLS_RECORD_HEADER_LENGTH;
+    msg_iov.iov_len = length;
+    msg.msg_iov = &msg_iov;
+    msg.msg_iovlen = 1;
+
+    ret = recvmsg(fd, &msg, 0);
+    if (ret <= 0)
+        return ret;
+
+    cmsg = CMSG_FIRSTHDR(&msg);
+    if (cmsg == NULL || cmsg->cmsg_level != SOL_TLS
+            || cmsg->cmsg_type != TLS_GET_RECORD_TYPE) {
+        errno = EIO;
+        return -1;
+    }
+    p[0] = *((unsigned char *)CMSG_DATA(cmsg));
+    p[1] = KTLS_RECORD_VERSION_MAJOR;
+    p[2] = KTLS_RECORD_VERSION_MINOR;
+    p[3] = (unsigned char)(ret >> 8);
+    p[4] = (unsigned char)ret;
+
+    return ret + KTLS_RECORD_HEADER_LENGTH;
+}
+
+/* Send |size| bytes of the file |fd| from |off| on as application data */
+static ossl_inline ossl_ssize_t ktls_sendfile(int s, int fd, off_t off,
+                                              size_t size)
+{
+    return sendfile(s, fd, &off, size);
+}
+# endif                         /* OPENSSL_NO_KTLS */
+
+#endif                          /* HEADER_INTERNAL_KTLS_H */
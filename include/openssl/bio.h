@@ -195,6 +195,11 @@ extern "C" {
 #  define BIO_CTRL_DGRAM_SCTP_SAVE_SHUTDOWN               70
 # endif
 
+# define BIO_CTRL_SET_KTLS                       72
+# define BIO_CTRL_GET_KTLS_SEND                  73
+# define BIO_CTRL_SET_KTLS_TX_SEND_CTRL_MSG      74
+# define BIO_CTRL_GET_KTLS_RECV                  75
+
 /* modifiers */
 # define BIO_FP_READ             0x02
 # define BIO_FP_WRITE            0x04
@@ -222,6 +227,16 @@ extern "C" {
  */
 # define BIO_FLAGS_MEM_RDONLY    0x200
 
+/*
+ * Used with socket BIOs: the kernel encrypts what is sent (kernel TLS), and
+ * the next write is a record of another type than application data. With
+ * BIO_FLAGS_KTLS_RX the kernel decrypts what is read, and each read returns
+ * one record with a plaintext header.
+ */
+# define BIO_FLAGS_KTLS_TX          0x800
+# define BIO_FLAGS_KTLS_TX_CTRL_MSG 0x1000
+# define BIO_FLAGS_KTLS_RX          0x2000
+
 typedef struct bio_st BIO;
 
 void BIO_set_flags(BIO *b, int flags);
@@ -560,6 +575,14 @@ int BIO_read_filename(BIO *b, const char *name);
 # define BIO_eof(b)              (int)BIO_ctrl(b,BIO_CTRL_EOF,0,NULL)
 # define BIO_set_close(b,c)      (int)BIO_ctrl(b,BIO_CTRL_SET_CLOSE,(c),NULL)
 # define BIO_get_close(b)        (int)BIO_ctrl(b,BIO_CTRL_GET_CLOSE,0,NULL)
+# define BIO_set_ktls(b,keyblob,is_tx) \
+        BIO_ctrl(b,BIO_CTRL_SET_KTLS,is_tx,keyblob)
+# define BIO_get_ktls_send(b) \
+        BIO_ctrl(b,BIO_CTRL_GET_KTLS_SEND,0,NULL)
+# define BIO_get_ktls_recv(b) \
+        BIO_ctrl(b,BIO_CTRL_GET_KTLS_RECV,0,NULL)
+# define BIO_set_ktls_ctrl_msg(b,record_type) \
+        BIO_ctrl(b,BIO_CTRL_SET_KTLS_TX_SEND_CTRL_MSG,record_type,NULL)
 # define BIO_pending(b)          (int)BIO_ctrl(b,BIO_CTRL_PENDING,0,NULL)
 # define BIO_wpending(b)         (int)BIO_ctrl(b,BIO_CTRL_WPENDING,0,NULL)
 /* ...pending macros have inappropriate return type */
@@ -206,7 +206,8 @@ extern "C" {
 # define CRYPTO_LOCK_COMP                38
 # define CRYPTO_LOCK_FIPS                39
 # define CRYPTO_LOCK_FIPS2               40
-# define CRYPTO_NUM_LOCKS                41
+# define CRYPTO_LOCK_DRBG                41
+# define CRYPTO_NUM_LOCKS                42
 
 # define CRYPTO_LOCK             1
 # define CRYPTO_UNLOCK           2
@@ -427,6 +428,44 @@ DEPRECATEDIN_1_0_0(void CRYPTO_set_id_callback(unsigned long (*func) (void)))
 DEPRECATEDIN_1_0_0(unsigned long (*CRYPTO_get_id_callback(void)) (void))
 DEPRECATEDIN_1_0_0(unsigned long CRYPTO_thread_id(void))
 
+/*
+ * Native one-time initialisation, thread-local storage, read/write locks
+ * and atomic counters. These do not depend on the locking or thread id
+ * callbacks.
+ */
+typedef void CRYPTO_RWLOCK;
+
+# if !defined(OPENSSL_THREADS) || defined(CRYPTO_TDEBUG)
+typedef unsigned int CRYPTO_ONCE;
+typedef unsigned int CRYPTO_THREAD_LOCAL;
+#  define CRYPTO_ONCE_STATIC_INIT 0
+# elif defined(OPENSSL_SYS_WINDOWS)
+#  include <windows.h>
+typedef LONG CRYPTO_ONCE;
+typedef DWORD CRYPTO_THREAD_LOCAL;
+#  define CRYPTO_ONCE_STATIC_INIT 0
+# else
+#  include <pthread.h>
+typedef pthread_once_t CRYPTO_ONCE;
+typedef pthread_key_t CRYPTO_THREAD_LOCAL;
+#  define CRYPTO_ONCE_STATIC_INIT PTHREAD_ONCE_INIT
+# endif
+
+int CRYPTO_THREAD_run_once(CRYPTO_ONCE *once, void (*init) (void));
+int CRYPTO_THREAD_init_local(CRYPTO_THREAD_LOCAL *key,
+                             void (*cleanup) (void *));
+void *CRYPTO_THREAD_get_local(CRYPTO_THREAD_LOCAL *key);
+int CRYPTO_THREAD_set_local(CRYPTO_THREAD_LOCAL *key, void *val);
+int CRYPTO_THREAD_cleanup_local(CRYPTO_THREAD_LOCAL *key);
+
+CRYPTO_RWLOCK *CRYPTO_THREAD_lock_new(void);
+int CRYPTO_THREAD_read_lock(CRYPTO_RWLOCK *lock);
+int CRYPTO_THREAD_write_lock(CRYPTO_RWLOCK *lock);
+int CRYPTO_THREAD_unlock(CRYPTO_RWLOCK *lock);
+void CRYPTO_THREAD_lock_free(CRYPTO_RWLOCK *lock);
+
+int CRYPTO_atomic_add(int *val, int amount, int *ret, CRYPTO_RWLOCK *lock);
+
 const char *CRYPTO_get_lock_name(int type);
 int CRYPTO_add_lock(int *pointer, int amount, int type, const char *file,
                     int line);
@@ -460,6 +499,14 @@ int CRYPTO_set_mem_functions(
         void *(*r) (void *, size_t, const char *, int),
         void (*f) (void *));
 int CRYPTO_set_mem_debug(int flag);
+int CRYPTO_set_mem_cache(int flag);
+int CRYPTO_get_mem_cache_stats(int size_class, size_t *size,
+                               unsigned long *allocs, unsigned long *hits,
+                               unsigned long *frees);
+int CRYPTO_set_mem_counters(int flag);
+int CRYPTO_get_mem_counters(unsigned long *allocs, unsigned long *frees,
+                            size_t *bytes, size_t *peak);
+void CRYPTO_reset_mem_counters(void);
 void CRYPTO_get_mem_functions(
         void *(**m) (size_t, const char *, int),
         void *(**r) (void *, size_t, const char *, int),
@@ -552,6 +599,7 @@ void ERR_load_CRYPTO_strings(void);
 /* Function codes. */
 # define CRYPTO_F_CRYPTO_DUP_EX_DATA                      110
 # define CRYPTO_F_CRYPTO_FREE_EX_DATA                     111
+# define CRYPTO_F_CRYPTO_FREE_EX_INDEX                    116
 # define CRYPTO_F_CRYPTO_GET_EX_NEW_INDEX                 100
 # define CRYPTO_F_CRYPTO_GET_NEW_DYNLOCKID                103
 # define CRYPTO_F_CRYPTO_GET_NEW_LOCKID                   101
@@ -562,12 +610,14 @@ void ERR_load_CRYPTO_strings(void);
 # define CRYPTO_F_DEF_GET_CLASS                           105
 # define CRYPTO_F_FIPS_MODE_SET                           109
 # define CRYPTO_F_GET_AND_LOCK                            113
+# define CRYPTO_F_GET_SNAPSHOT                            117
 # define CRYPTO_F_INT_DUP_EX_DATA                         106
 # define CRYPTO_F_INT_FREE_EX_DATA                        107
 # define CRYPTO_F_INT_NEW_EX_DATA                         108
 # define CRYPTO_F_OPENSSL_MEMDUP                          114
 
 /* Reason codes. */
+# define CRYPTO_R_BAD_EX_DATA_CLASS                       102
 # define CRYPTO_R_FIPS_MODE_NOT_SUPPORTED                 101
 # define CRYPTO_R_NO_DYNLOCK_CREATE_CALLBACK              100
 
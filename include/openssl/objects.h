@@ -998,6 +998,13 @@ const char *OBJ_NAME_get(const char *name, int type);
 int OBJ_NAME_add(const char *name, int type, const char *data);
 int OBJ_NAME_remove(const char *name, int type);
 void OBJ_NAME_cleanup(int type); /* -1 for everything */
+/*
+ * Take a read-only snapshot of all names that OBJ_NAME_get() then uses
+ * without locking, until the next OBJ_NAME_add(), OBJ_NAME_remove() or
+ * OBJ_NAME_new_index().
+ * Called at the end of OPENSSL_add_all_algorithms() and SSL_library_init().
+ */
+int OBJ_NAME_freeze(void);
 void OBJ_NAME_do_all(int type, void (*fn) (const OBJ_NAME *, void *arg),
                      void *arg);
 void OBJ_NAME_do_all_sorted(int type,
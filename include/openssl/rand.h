@@ -93,6 +93,7 @@ const RAND_METHOD *RAND_get_rand_method(void);
 int RAND_set_rand_engine(ENGINE *engine);
 # endif
 RAND_METHOD *RAND_OpenSSL(void);
+RAND_METHOD *RAND_CTR_DRBG(void);
 void RAND_cleanup(void);
 int RAND_bytes(unsigned char *buf, int num);
 DEPRECATEDIN_1_1_0(int RAND_pseudo_bytes(unsigned char *buf, int num))
@@ -129,6 +130,7 @@ void ERR_load_RAND_strings(void);
 /* Error codes for the RAND functions. */
 
 /* Function codes. */
+# define RAND_F_DRBG_BYTES                                107
 # define RAND_F_FIPS_RAND                                 102
 # define RAND_F_FIPS_RAND_SET_DT                          103
 # define RAND_F_FIPS_SET_PRNG_SEED                        104
@@ -314,6 +314,11 @@ extern "C" {
 
 __owur const char *SSL_get_servername(const SSL *s, const int type);
 __owur int SSL_get_servername_type(const SSL *s);
+__owur int SSL_client_hello_get0_ext(SSL *s, unsigned int type,
+                                     const unsigned char **out,
+                                     size_t *outlen);
+__owur int SSL_client_hello_get1_extensions_present(SSL *s, int **out,
+                                                    size_t *outlen);
 /*
  * SSL_export_keying_material exports a value derived from the master secret,
  * as specified in RFC 5705. It writes |olen| bytes to |out| given a label and
@@ -418,6 +418,8 @@ struct ISSUING_DIST_POINT_st {
 # define EXFLAG_FRESHEST         0x1000
 /* Self signed */
 # define EXFLAG_SS               0x2000
+/* SHA-1 fingerprint has been cached */
+# define EXFLAG_SHA1             0x4000
 
 # define KU_DIGITAL_SIGNATURE    0x0080
 # define KU_NON_REPUDIATION      0x0040
@@ -366,7 +366,8 @@ static long ssl_ctrl(BIO *b, int cmd, long num, void *ptr)
         break;
     case BIO_CTRL_FLUSH:
         BIO_clear_retry_flags(b);
-        ret = BIO_ctrl(ssl->wbio, cmd, num, ptr);
+        /* Also sends the records held back by write coalescing */
+        ret = SSL_flush(ssl);
         BIO_copy_next_retry(b);
         break;
     case BIO_CTRL_PUSH:
@@ -136,12 +136,13 @@
 void RECORD_LAYER_init(RECORD_LAYER *rl, SSL *s)
 {
     rl->s = s;
-    SSL3_RECORD_clear(&rl->rrec);
-    SSL3_RECORD_clear(&rl->wrec);
+    SSL3_RECORD_clear(rl->rrec, SSL_MAX_PIPELINES);
 }
 
 void RECORD_LAYER_clear(RECORD_LAYER *rl)
 {
+    unsigned int pipes;
+
     rl->rstate = SSL_ST_READ_HEADER;
 
     /* Do I need to clear read_ahead? As far as I can tell read_ahead did not
@@ -160,11 +161,13 @@ void RECORD_LAYER_clear(RECORD_LAYER *rl)
     rl->wpend_type = 0;
     rl->wpend_ret = 0;
     rl->wpend_buf = NULL;
+    rl->wheld = 0;
 
     SSL3_BUFFER_clear(&rl->rbuf);
-    SSL3_BUFFER_clear(&rl->wbuf);
-    SSL3_RECORD_clear(&rl->rrec);
-    SSL3_RECORD_clear(&rl->wrec);
+    for (pipes = 0; pipes < rl->numwpipes; pipes++)
+        SSL3_BUFFER_clear(&rl->wbuf[pipes]);
+    rl->numrpipes = 0;
+    SSL3_RECORD_clear(rl->rrec, SSL_MAX_PIPELINES);
 
     RECORD_LAYER_reset_read_sequence(rl);
     RECORD_LAYER_reset_write_sequence(rl);
@@ -177,19 +180,28 @@ void RECORD_LAYER_release(RECORD_LAYER *rl)
 {
     if (SSL3_BUFFER_is_initialised(&rl->rbuf))
         ssl3_release_read_buffer(rl->s);
-    if (SSL3_BUFFER_is_initialised(&rl->wbuf))
+    if (rl->numwpipes > 0)
         ssl3_release_write_buffer(rl->s);
-    SSL3_RECORD_release(&rl->rrec);
+    SSL3_RECORD_release(rl->rrec, SSL_MAX_PIPELINES);
 }
 
-int RECORD_LAYER_read_pending(RECORD_LAYER *rl)
+int RECORD_LAYER_read_pending(const RECORD_LAYER *rl)
 {
     return SSL3_BUFFER_get_left(&rl->rbuf) != 0;
 }
 
 int RECORD_LAYER_write_pending(RECORD_LAYER *rl)
 {
-    return SSL3_BUFFER_get_left(&rl->wbuf) != 0;
+    unsigned int pipes;
+
+    /* Held records were accepted, they only wait for a flush */
+    if (rl->wheld)
+        return 0;
+    for (pipes = 0; pipes < rl->numwpipes; pipes++) {
+        if (SSL3_BUFFER_get_left(&rl->wbuf[pipes]) != 0)
+            return 1;
+    }
+    return 0;
 }
 
 int RECORD_LAYER_set_data(RECORD_LAYER *rl, const unsigned char *buf, int len)
@@ -220,16 +232,30 @@ void RECORD_LAYER_reset_write_sequence(RECORD_LAYER *rl)
 
 int RECORD_LAYER_setup_comp_buffer(RECORD_LAYER *rl)
 {
-    return SSL3_RECORD_setup(&(rl)->rrec);
+    return SSL3_RECORD_setup(&rl->rrec[0]);
 }
 
 int ssl3_pending(const SSL *s)
 {
+    unsigned int i, num;
+    int ret = 0;
+
     if (s->rlayer.rstate == SSL_ST_READ_BODY)
         return 0;
 
-    return (SSL3_RECORD_get_type(&s->rlayer.rrec) == SSL3_RT_APPLICATION_DATA)
-           ? SSL3_RECORD_get_length(&s->rlayer.rrec) : 0;
+    /* DTLS only ever decodes into the first record */
+    num = RECORD_LAYER_get_numrpipes(&s->rlayer);
+    if (num == 0)
+        num = 1;
+
+    for (i = 0; i < num; i++) {
+        if (SSL3_RECORD_get_type(&s->rlayer.rrec[i])
+            != SSL3_RT_APPLICATION_DATA)
+            return 0;
+        ret += SSL3_RECORD_get_length(&s->rlayer.rrec[i]);
+    }
+
+    return ret;
 }
 
 const char *SSL_rstate_string_long(const SSL *s)
@@ -274,7 +300,7 @@ const char *SSL_rstate_string(const SSL *s)
     return (str);
 }
 
-int ssl3_read_n(SSL *s, int n, int max, int extend)
+int ssl3_read_n(SSL *s, int n, int max, int extend, int clearold)
 {
     /*
      * If extend == 0, obtain new n-byte packet; if extend == 1, increase
@@ -282,6 +308,9 @@ int ssl3_read_n(SSL *s, int n, int max, int extend)
      * s->s3->rbuf.buf specified by s->packet and s->packet_length. (If
      * s->rlayer.read_ahead is set, 'max' bytes may be stored in rbuf [plus
      * s->packet_length bytes if extend == 1].)
+     * if clearold == 1, move the packet to the start of the buffer; if
+     * clearold == 0 then leave any old packets where they were, since
+     * earlier records of a pipelined read still point into them.
      */
     int i, len, left;
     size_t align = 0;
@@ -306,7 +335,7 @@ int ssl3_read_n(SSL *s, int n, int max, int extend)
         /* start with empty packet ... */
         if (left == 0)
             rb->offset = align;
-        else if (align != 0 && left >= SSL3_RT_HEADER_LENGTH) {
+        else if (align != 0 && left >= SSL3_RT_HEADER_LENGTH && clearold) {
             /*
              * check if next packet length is large enough to justify payload
              * alignment...
@@ -352,25 +381,38 @@ int ssl3_read_n(SSL *s, int n, int max, int extend)
 
     /* else we need to read more data */
 
+    /* The peer may be waiting for what we hold back before it replies */
+    if (s->rlayer.wheld) {
+        i = ssl3_write_held(s);
+        if (i <= 0)
+            return i;
+    }
+
     len = s->rlayer.packet_length;
     pkt = rb->buf + align;
     /*
      * Move any available bytes to front of buffer: 'len' bytes already
      * pointed to by 'packet', 'left' extra ones at the end
      */
-    if (s->rlayer.packet != pkt) {     /* len > 0 */
+    if (s->rlayer.packet != pkt && clearold) { /* len > 0 */
         memmove(pkt, s->rlayer.packet, len + left);
         s->rlayer.packet = pkt;
         rb->offset = len + align;
     }
+    /* Records we did not move are extended in place */
+    pkt = s->rlayer.packet;
 
     if (n > (int)(rb->len - rb->offset)) { /* does not happen */
         SSLerr(SSL_F_SSL3_READ_N, ERR_R_INTERNAL_ERROR);
         return -1;
     }
 
-    /* We always act like read_ahead is set for DTLS */
-    if (!s->rlayer.read_ahead && !SSL_IS_DTLS(s))
+    /*
+     * We always act like read_ahead is set for DTLS, and for kernel TLS,
+     * which only returns whole records
+     */
+    if (!s->rlayer.read_ahead && !SSL_IS_DTLS(s)
+            && BIO_get_ktls_recv(s->rbio) <= 0)
         /* ignore max parameter */
         max = n;
     else {
@@ -428,23 +470,74 @@ int ssl3_read_n(SSL *s, int n, int max, int extend)
  * Call this to write data in records of type 'type' It will return <= 0 if
  * not all data has been sent or non-blocking IO.
  */
-int ssl3_write_bytes(SSL *s, int type, const void *buf_, int len)
+int ssl3_write_bytes(SSL *s, int type, const void *buf, int len)
 {
-    const unsigned char *buf = buf_;
-    int tot;
-    unsigned int n, nw;
-#if !defined(OPENSSL_NO_MULTIBLOCK) && EVP_CIPH_FLAG_TLS1_1_MULTIBLOCK
-    unsigned int max_send_fragment;
-    unsigned int u_len = (unsigned int)len;
-#endif
-    SSL3_BUFFER *wb = &s->rlayer.wbuf;
-    int i;
+    SSL_IOVEC iov;
 
     if (len < 0) {
         SSLerr(SSL_F_SSL3_WRITE_BYTES, SSL_R_SSL_NEGATIVE_LENGTH);
         return -1;
     }
 
+    iov.buf = buf;
+    iov.len = len;
+    return ssl3_writev_bytes(s, type, &iov, 1, len);
+}
+
+/*
+ * Copy |len| bytes to |out|, starting |off| bytes into the |iov| list
+ */
+static void ssl3_gather(unsigned char *out, const SSL_IOVEC *iov, size_t off,
+                        size_t len)
+{
+    size_t n;
+
+    for (; len > 0; iov++) {
+        if (off >= iov->len) {
+            off -= iov->len;
+            continue;
+        }
+        n = iov->len - off;
+        if (n > len)
+            n = len;
+        memcpy(out, (const unsigned char *)iov->buf + off, n);
+        out += n;
+        len -= n;
+        off = 0;
+    }
+}
+
+/*
+ * The pointer ssl3_write_pending() checks write retries against. A single
+ * buffer must be passed again at the same place, like with SSL_write(); for
+ * a list it is the list itself.
+ */
+static const unsigned char *ssl3_wpend_key(const SSL_IOVEC *iov,
+                                           unsigned int iovcnt, int tot)
+{
+    if (iovcnt == 1)
+        return (const unsigned char *)iov->buf + tot;
+    return (const unsigned char *)iov;
+}
+
+/*
+ * As ssl3_write_bytes(), but the |len| bytes to write are gathered from the
+ * |iovcnt| buffers in |iov| straight into the records.
+ */
+int ssl3_writev_bytes(SSL *s, int type, const SSL_IOVEC *iov,
+                      unsigned int iovcnt, int len)
+{
+    const unsigned char *buf = iovcnt == 1 ? iov->buf : NULL;
+    int tot;
+    unsigned int n, split_send_fragment, maxpipes;
+#if !defined(OPENSSL_NO_MULTIBLOCK) && EVP_CIPH_FLAG_TLS1_1_MULTIBLOCK
+    unsigned int max_send_fragment, nw;
+    unsigned int u_len = (unsigned int)len;
+#endif
+    SSL3_BUFFER *wb = &s->rlayer.wbuf[0];
+    int i;
+    unsigned int j;
+
     s->rwstate = SSL_NOTHING;
     tot = s->rlayer.wnum;
     /*
@@ -457,7 +550,7 @@ int ssl3_write_bytes(SSL *s, int type, const void *buf_, int len)
      * report the error in a way the user will notice
      */
     if ((unsigned int)len < s->rlayer.wnum) {
-        SSLerr(SSL_F_SSL3_WRITE_BYTES, SSL_R_BAD_LENGTH);
+        SSLerr(SSL_F_SSL3_WRITEV_BYTES, SSL_R_BAD_LENGTH);
         return -1;
     }
 
@@ -469,7 +562,7 @@ int ssl3_write_bytes(SSL *s, int type, const void *buf_, int len)
         if (i < 0)
             return (i);
         if (i == 0) {
-            SSLerr(SSL_F_SSL3_WRITE_BYTES, SSL_R_SSL_HANDSHAKE_FAILURE);
+            SSLerr(SSL_F_SSL3_WRITEV_BYTES, SSL_R_SSL_HANDSHAKE_FAILURE);
             return -1;
         }
     }
@@ -478,8 +571,9 @@ int ssl3_write_bytes(SSL *s, int type, const void *buf_, int len)
      * first check if there is a SSL3_BUFFER still being written out.  This
      * will happen with non blocking IO
      */
-    if (wb->left != 0) {
-        i = ssl3_write_pending(s, type, &buf[tot], s->rlayer.wpend_tot);
+    if (RECORD_LAYER_write_pending(&s->rlayer)) {
+        i = ssl3_write_pending(s, type, ssl3_wpend_key(iov, iovcnt, tot),
+                               s->rlayer.wpend_tot);
         if (i <= 0) {
             /* XXX should we ssl3_release_write_buffer if i<0? */
             s->rlayer.wnum = tot;
@@ -492,10 +586,11 @@ int ssl3_write_bytes(SSL *s, int type, const void *buf_, int len)
      * Depending on platform multi-block can deliver several *times*
      * better performance. Downside is that it has to allocate
      * jumbo buffer to accomodate up to 8 records, but the
-     * compromise is considered worthy.
+     * compromise is considered worthy. It needs its input in one piece.
      */
-    if (type == SSL3_RT_APPLICATION_DATA &&
+    if (type == SSL3_RT_APPLICATION_DATA && buf != NULL &&
         u_len >= 4 * (max_send_fragment = s->max_send_fragment) &&
+        !s->rlayer.wheld &&
         s->compress == NULL && s->msg_callback == NULL &&
         !SSL_USE_ETM(s) && SSL_USE_EXPLICIT_IV(s) &&
         EVP_CIPHER_flags(EVP_CIPHER_CTX_cipher(s->enc_write_ctx)) &
@@ -520,23 +615,21 @@ int ssl3_write_bytes(SSL *s, int type, const void *buf_, int len)
             else
                 packlen *= 4;
 
-            wb->buf = OPENSSL_malloc(packlen);
-            if (wb->buf == NULL) {
-                SSLerr(SSL_F_SSL3_WRITE_BYTES, ERR_R_MALLOC_FAILURE);
+            if (!ssl3_setup_write_buffer(s, 1, packlen)) {
+                SSLerr(SSL_F_SSL3_WRITEV_BYTES, ERR_R_MALLOC_FAILURE);
                 return -1;
             }
-            wb->len = packlen;
         } else if (tot == len) { /* done? */
-            OPENSSL_free(wb->buf); /* free jumbo buffer */
-            wb->buf = NULL;
+            /* free jumbo buffer */
+            ssl3_release_write_buffer(s);
             return tot;
         }
 
         n = (len - tot);
         for (;;) {
             if (n < 4 * max_send_fragment) {
-                OPENSSL_free(wb->buf); /* free jumbo buffer */
-                wb->buf = NULL;
+                /* free jumbo buffer */
+                ssl3_release_write_buffer(s);
                 break;
             }
 
@@ -568,8 +661,8 @@ int ssl3_write_bytes(SSL *s, int type, const void *buf_, int len)
                                           sizeof(mb_param), &mb_param);
 
             if (packlen <= 0 || packlen > (int)wb->len) { /* never happens */
-                OPENSSL_free(wb->buf); /* free jumbo buffer */
-                wb->buf = NULL;
+                /* free jumbo buffer */
+                ssl3_release_write_buffer(s);
                 break;
             }
 
@@ -599,15 +692,15 @@ int ssl3_write_bytes(SSL *s, int type, const void *buf_, int len)
             i = ssl3_write_pending(s, type, &buf[tot], nw);
             if (i <= 0) {
                 if (i < 0 && (!s->wbio || !BIO_should_retry(s->wbio))) {
-                    OPENSSL_free(wb->buf);
-                    wb->buf = NULL;
+                    /* free jumbo buffer */
+                    ssl3_release_write_buffer(s);
                 }
                 s->rlayer.wnum = tot;
                 return i;
             }
             if (i == (int)n) {
-                OPENSSL_free(wb->buf); /* free jumbo buffer */
-                wb->buf = NULL;
+                /* free jumbo buffer */
+                ssl3_release_write_buffer(s);
                 return tot + i;
             }
             n -= i;
@@ -616,20 +709,77 @@ int ssl3_write_bytes(SSL *s, int type, const void *buf_, int len)
     } else
 #endif
     if (tot == len) {           /* done? */
-        if (s->mode & SSL_MODE_RELEASE_BUFFERS && !SSL_IS_DTLS(s))
+        if (s->mode & SSL_MODE_RELEASE_BUFFERS && !SSL_IS_DTLS(s)
+                && !s->rlayer.wheld)
             ssl3_release_write_buffer(s);
 
         return tot;
     }
 
     n = (len - tot);
+
+    split_send_fragment = s->split_send_fragment;
+    /*
+     * If max_pipelines is greater than one then this means we are going to
+     * try to send as many records in parallel as the cipher lets us. Only
+     * ciphers with an explicit IV can do that: otherwise each record's IV
+     * depends on the previous record's ciphertext.
+     */
+    maxpipes = s->max_pipelines;
+    if (maxpipes > SSL_MAX_PIPELINES) {
+        /*
+         * We should have prevented this when we set max_pipelines so we
+         * shouldn't get here
+         */
+        SSLerr(SSL_F_SSL3_WRITEV_BYTES, ERR_R_INTERNAL_ERROR);
+        return -1;
+    }
+    if (maxpipes == 0
+        || s->enc_write_ctx == NULL
+        || !(EVP_CIPHER_flags(EVP_CIPHER_CTX_cipher(s->enc_write_ctx))
+             & EVP_CIPH_FLAG_PIPELINE)
+        || !SSL_USE_EXPLICIT_IV(s)
+        || BIO_get_ktls_send(s->wbio) > 0)
+        maxpipes = 1;
+    if (s->max_send_fragment == 0 || split_send_fragment == 0
+        || split_send_fragment > s->max_send_fragment) {
+        /*
+         * We should have prevented this when we set the split and max send
+         * fragments so we shouldn't get here
+         */
+        SSLerr(SSL_F_SSL3_WRITEV_BYTES, ERR_R_INTERNAL_ERROR);
+        return -1;
+    }
+
     for (;;) {
-        if (n > s->max_send_fragment)
-            nw = s->max_send_fragment;
-        else
-            nw = n;
+        unsigned int pipelens[SSL_MAX_PIPELINES], tmppipelen, remain;
+        unsigned int numpipes;
+
+        numpipes = ((n - 1) / split_send_fragment) + 1;
+        if (numpipes > maxpipes)
+            numpipes = maxpipes;
+
+        if (n / numpipes >= s->max_send_fragment) {
+            /*
+             * We have enough data to completely fill all available
+             * pipelines
+             */
+            for (j = 0; j < numpipes; j++)
+                pipelens[j] = s->max_send_fragment;
+        } else {
+            /* We can partially fill all available pipelines */
+            tmppipelen = n / numpipes;
+            remain = n % numpipes;
+            for (j = 0; j < numpipes; j++) {
+                pipelens[j] = tmppipelen;
+                if (j < remain)
+                    pipelens[j]++;
+            }
+        }
 
-        i = do_ssl3_write(s, type, &(buf[tot]), nw, 0);
+        i = do_ssl3_writev(s, type, iov, iovcnt, tot,
+                           ssl3_wpend_key(iov, iovcnt, tot), pipelens,
+                           numpipes, 0);
         if (i <= 0) {
             /* XXX should we ssl3_release_write_buffer if i<0? */
             s->rlayer.wnum = tot;
@@ -646,7 +796,7 @@ int ssl3_write_bytes(SSL *s, int type, const void *buf_, int len)
             s->s3->empty_fragment_done = 0;
 
             if ((i == (int)n) && s->mode & SSL_MODE_RELEASE_BUFFERS &&
-                !SSL_IS_DTLS(s))
+                !SSL_IS_DTLS(s) && !s->rlayer.wheld)
                 ssl3_release_write_buffer(s);
 
             return tot + i;
@@ -658,23 +808,51 @@ int ssl3_write_bytes(SSL *s, int type, const void *buf_, int len)
 }
 
 int do_ssl3_write(SSL *s, int type, const unsigned char *buf,
-                  unsigned int len, int create_empty_fragment)
+                  unsigned int *pipelens, unsigned int numpipes,
+                  int create_empty_fragment)
 {
-    unsigned char *p, *plen;
+    SSL_IOVEC iov;
+    unsigned int j;
+
+    iov.buf = buf;
+    iov.len = 0;
+    for (j = 0; j < numpipes; j++)
+        iov.len += pipelens[j];
+    return do_ssl3_writev(s, type, &iov, 1, 0, buf, pipelens, numpipes,
+                          create_empty_fragment);
+}
+
+/*
+ * Write |numpipes| records of |pipelens| bytes each, taken from the |iov|
+ * list starting |off| bytes in. |buf| identifies the data to
+ * ssl3_write_pending() for write retries.
+ */
+int do_ssl3_writev(SSL *s, int type, const SSL_IOVEC *iov,
+                   unsigned int iovcnt, size_t off, const unsigned char *buf,
+                   unsigned int *pipelens, unsigned int numpipes,
+                   int create_empty_fragment)
+{
+    unsigned char *outbuf[SSL_MAX_PIPELINES], *plen[SSL_MAX_PIPELINES];
+    unsigned char *compbuf = NULL;
+    SSL3_RECORD wr[SSL_MAX_PIPELINES];
     int i, mac_size, clear = 0;
     int prefix_len = 0;
     int eivlen;
     size_t align = 0;
-    SSL3_RECORD *wr;
-    SSL3_BUFFER *wb = &s->rlayer.wbuf;
+    SSL3_BUFFER *wb;
     SSL_SESSION *sess;
+    unsigned int totlen = 0, held = 0;
+    unsigned int j;
+    int ktls;
 
+    for (j = 0; j < numpipes; j++)
+        totlen += pipelens[j];
     /*
      * first check if there is a SSL3_BUFFER still being written out.  This
      * will happen with non blocking IO
      */
-    if (SSL3_BUFFER_get_left(wb) != 0)
-        return (ssl3_write_pending(s, type, buf, len));
+    if (RECORD_LAYER_write_pending(&s->rlayer))
+        return (ssl3_write_pending(s, type, buf, totlen));
 
     /* If we have an alert to send, lets send it */
     if (s->s3->alert_dispatch) {
@@ -684,14 +862,75 @@ int do_ssl3_write(SSL *s, int type, const unsigned char *buf,
         /* if it went, fall through and send more stuff */
     }
 
-    if (!SSL3_BUFFER_is_initialised(wb))
-        if (!ssl3_setup_write_buffer(s))
+    /*
+     * Records held back by write coalescing go out first if this record is
+     * not coalesced with them, or if it might not fit behind them (with an
+     * empty fragment in front of it)
+     */
+    if (s->rlayer.wheld) {
+        size_t need = totlen
+                      + 2 * (SSL3_RT_HEADER_LENGTH
+                             + SSL3_RT_SEND_MAX_ENCRYPTED_OVERHEAD);
+
+        wb = &s->rlayer.wbuf[0];
+#ifndef OPENSSL_NO_COMP
+        if (s->compress != NULL)
+            need += SSL3_RT_MAX_COMPRESSED_OVERHEAD;
+#endif
+        if (type != SSL3_RT_APPLICATION_DATA || numpipes != 1
+                || SSL3_BUFFER_get_offset(wb) + SSL3_BUFFER_get_left(wb)
+                   + need > SSL3_BUFFER_get_len(wb)) {
+            i = ssl3_write_held(s);
+            if (i <= 0)
+                return i;
+        } else {
+            held = SSL3_BUFFER_get_left(wb);
+        }
+    }
+
+    ktls = BIO_get_ktls_send(s->wbio) > 0;
+
+    /* Coalescing needs a bigger buffer than may have been set up so far */
+    if (!held && !ktls && s->write_coalesce_size > 0
+            && type == SSL3_RT_APPLICATION_DATA && numpipes == 1
+            && SSL3_BUFFER_is_initialised(&s->rlayer.wbuf[0])
+            && SSL3_BUFFER_get_len(&s->rlayer.wbuf[0])
+               < s->write_coalesce_size)
+        ssl3_release_write_buffer(s);
+
+    if (s->rlayer.numwpipes < numpipes)
+        if (!ssl3_setup_write_buffer(s, numpipes, 0))
             return -1;
 
-    if (len == 0 && !create_empty_fragment)
+    if (totlen == 0 && !create_empty_fragment)
         return 0;
 
-    wr = &s->rlayer.wrec;
+    if (ktls) {
+        /*
+         * The kernel encrypts and frames the records, so only the plaintext
+         * goes to the socket, tagged with its type unless it is application
+         * data
+         */
+        if (numpipes != 1 || create_empty_fragment || held) {
+            SSLerr(SSL_F_DO_SSL3_WRITEV, ERR_R_INTERNAL_ERROR);
+            return -1;
+        }
+        if (type != SSL3_RT_APPLICATION_DATA
+                && BIO_set_ktls_ctrl_msg(s->wbio, type) <= 0) {
+            SSLerr(SSL_F_DO_SSL3_WRITEV, ERR_R_INTERNAL_ERROR);
+            return -1;
+        }
+        wb = &s->rlayer.wbuf[0];
+        ssl3_gather(SSL3_BUFFER_get_buf(wb), iov, off, totlen);
+        SSL3_BUFFER_set_offset(wb, 0);
+        SSL3_BUFFER_set_left(wb, totlen);
+        s->rlayer.wpend_tot = totlen;
+        s->rlayer.wpend_buf = buf;
+        s->rlayer.wpend_type = type;
+        s->rlayer.wpend_ret = totlen;
+        return ssl3_write_pending(s, type, buf, totlen);
+    }
+
     sess = s->session;
 
     if ((sess == NULL) ||
@@ -721,7 +960,10 @@ int do_ssl3_write(SSL *s, int type, const unsigned char *buf,
              * 'prefix_len' bytes are sent out later together with the actual
              * payload)
              */
-            prefix_len = do_ssl3_write(s, type, buf, 0, 1);
+            unsigned int tmppipelen = 0;
+
+            prefix_len = do_ssl3_writev(s, type, iov, iovcnt, off, buf,
+                                        &tmppipelen, 1, 1);
             if (prefix_len <= 0)
                 goto err;
 
@@ -729,7 +971,7 @@ int do_ssl3_write(SSL *s, int type, const unsigned char *buf,
                 (SSL3_RT_HEADER_LENGTH + SSL3_RT_SEND_MAX_ENCRYPTED_OVERHEAD))
             {
                 /* insufficient space */
-                SSLerr(SSL_F_DO_SSL3_WRITE, ERR_R_INTERNAL_ERROR);
+                SSLerr(SSL_F_DO_SSL3_WRITEV, ERR_R_INTERNAL_ERROR);
                 goto err;
             }
         }
@@ -737,7 +979,13 @@ int do_ssl3_write(SSL *s, int type, const unsigned char *buf,
         s->s3->empty_fragment_done = 1;
     }
 
-    if (create_empty_fragment) {
+    if (create_empty_fragment && held) {
+        /* goes right behind the held records */
+        wb = &s->rlayer.wbuf[0];
+        outbuf[0] = SSL3_BUFFER_get_buf(wb) + SSL3_BUFFER_get_offset(wb)
+                    + held;
+    } else if (create_empty_fragment) {
+        wb = &s->rlayer.wbuf[0];
 #if defined(SSL3_ALIGN_PAYLOAD) && SSL3_ALIGN_PAYLOAD!=0
         /*
          * extra fragment would be couple of cipher blocks, which would be
@@ -747,38 +995,29 @@ int do_ssl3_write(SSL *s, int type, const unsigned char *buf,
         align = (size_t)SSL3_BUFFER_get_buf(wb) + 2 * SSL3_RT_HEADER_LENGTH;
         align = (0-align) & (SSL3_ALIGN_PAYLOAD - 1);
 #endif
-        p = SSL3_BUFFER_get_buf(wb) + align;
+        outbuf[0] = SSL3_BUFFER_get_buf(wb) + align;
         SSL3_BUFFER_set_offset(wb, align);
     } else if (prefix_len) {
-        p = SSL3_BUFFER_get_buf(wb) + SSL3_BUFFER_get_offset(wb) + prefix_len;
+        /* empty fragments are only ever sent by non-pipelining ciphers */
+        wb = &s->rlayer.wbuf[0];
+        outbuf[0] = SSL3_BUFFER_get_buf(wb) + SSL3_BUFFER_get_offset(wb)
+                    + held + prefix_len;
+    } else if (held) {
+        wb = &s->rlayer.wbuf[0];
+        outbuf[0] = SSL3_BUFFER_get_buf(wb) + SSL3_BUFFER_get_offset(wb)
+                    + held;
     } else {
+        for (j = 0; j < numpipes; j++) {
+            wb = &s->rlayer.wbuf[j];
 #if defined(SSL3_ALIGN_PAYLOAD) && SSL3_ALIGN_PAYLOAD!=0
-        align = (size_t)SSL3_BUFFER_get_buf(wb) + SSL3_RT_HEADER_LENGTH;
-        align = (0-align) & (SSL3_ALIGN_PAYLOAD - 1);
+            align = (size_t)SSL3_BUFFER_get_buf(wb) + SSL3_RT_HEADER_LENGTH;
+            align = (0-align) & (SSL3_ALIGN_PAYLOAD - 1);
 #endif
-        p = SSL3_BUFFER_get_buf(wb) + align;
-        SSL3_BUFFER_set_offset(wb, align);
+            outbuf[j] = SSL3_BUFFER_get_buf(wb) + align;
+            SSL3_BUFFER_set_offset(wb, align);
+        }
     }
 
-    /* write the header */
-
-    *(p++) = type & 0xff;
-    SSL3_RECORD_set_type(wr, type);
-
-    *(p++) = (s->version >> 8);
-    /*
-     * Some servers hang if iniatial client hello is larger than 256 bytes
-     * and record version number > TLS 1.0
-     */
-    if (SSL_get_state(s) == TLS_ST_CW_CLNT_HELLO
-        && !s->renegotiate && TLS1_get_version(s) > TLS1_VERSION)
-        *(p++) = 0x1;
-    else
-        *(p++) = s->version & 0xff;
-
-    /* field where we are to write out packet length */
-    plen = p;
-    p += 2;
     /* Explicit IV length, block ciphers appropriate version flag */
     if (s->enc_write_ctx && SSL_USE_EXPLICIT_IV(s)) {
         int mode = EVP_CIPHER_CTX_mode(s->enc_write_ctx);
@@ -797,95 +1036,158 @@ int do_ssl3_write(SSL *s, int type, const unsigned char *buf,
     } else
         eivlen = 0;
 
-    /* lets setup the record stuff. */
-    SSL3_RECORD_set_data(wr, p + eivlen);
-    SSL3_RECORD_set_length(wr, (int)len);
-    SSL3_RECORD_set_input(wr, (unsigned char *)buf);
-
+    totlen = 0;
+    memset(wr, 0, sizeof(*wr) * numpipes);
+    for (j = 0; j < numpipes; j++) {
+        /* write the header */
+        *(outbuf[j]++) = type & 0xff;
+        SSL3_RECORD_set_type(&wr[j], type);
 
-    /*
-     * we now 'read' from wr->input, wr->length bytes into wr->data
-     */
+        *(outbuf[j]++) = (s->version >> 8);
+        /*
+         * Some servers hang if iniatial client hello is larger than 256 bytes
+         * and record version number > TLS 1.0
+         */
+        if (SSL_get_state(s) == TLS_ST_CW_CLNT_HELLO
+            && !s->renegotiate && TLS1_get_version(s) > TLS1_VERSION)
+            *(outbuf[j]++) = 0x1;
+        else
+            *(outbuf[j]++) = s->version & 0xff;
 
-    /* first we compress */
-    if (s->compress != NULL) {
-        if (!ssl3_do_compress(s)) {
-            SSLerr(SSL_F_DO_SSL3_WRITE, SSL_R_COMPRESSION_FAILURE);
-            goto err;
-        }
-    } else {
-        memcpy(wr->data, wr->input, wr->length);
-        SSL3_RECORD_reset_input(wr);
-    }
+        /* field where we are to write out packet length */
+        plen[j] = outbuf[j];
+        outbuf[j] += 2;
 
-    /*
-     * we should still have the output to wr->data and the input from
-     * wr->input.  Length should be wr->length. wr->data still points in the
-     * wb->buf
-     */
+        /* lets setup the record stuff. */
+        SSL3_RECORD_set_data(&wr[j], outbuf[j] + eivlen);
+        SSL3_RECORD_set_length(&wr[j], (int)pipelens[j]);
 
-    if (!SSL_USE_ETM(s) && mac_size != 0) {
-        if (s->method->ssl3_enc->mac(s, &(p[wr->length + eivlen]), 1) < 0)
-            goto err;
-        SSL3_RECORD_add_length(wr, mac_size);
-    }
+        /*
+         * we now 'read' from the iov list, wr->length bytes into wr->data
+         */
 
-    SSL3_RECORD_set_data(wr, p);
-    SSL3_RECORD_reset_input(wr);
+        /* first we compress */
+        if (s->compress != NULL) {
+            /* The compressor needs its input in one piece */
+            if (iovcnt == 1) {
+                SSL3_RECORD_set_input(&wr[j], (unsigned char *)iov->buf
+                                              + off + totlen);
+            } else {
+                if (compbuf == NULL
+                        && (compbuf = OPENSSL_malloc(s->max_send_fragment))
+                           == NULL) {
+                    SSLerr(SSL_F_DO_SSL3_WRITEV, ERR_R_MALLOC_FAILURE);
+                    goto err;
+                }
+                ssl3_gather(compbuf, iov, off + totlen, pipelens[j]);
+                SSL3_RECORD_set_input(&wr[j], compbuf);
+            }
+            if (!ssl3_do_compress(s, &wr[j])) {
+                SSLerr(SSL_F_DO_SSL3_WRITEV, SSL_R_COMPRESSION_FAILURE);
+                goto err;
+            }
+        } else {
+            ssl3_gather(wr[j].data, iov, off + totlen, wr[j].length);
+            SSL3_RECORD_reset_input(&wr[j]);
+        }
+        totlen += pipelens[j];
 
-    if (eivlen) {
         /*
-         * if (RAND_pseudo_bytes(p, eivlen) <= 0) goto err;
+         * we should still have the output to wr->data and the input from
+         * wr->input.  Length should be wr->length. wr->data still points in the
+         * wb->buf
          */
-        SSL3_RECORD_add_length(wr, eivlen);
-    }
 
-    if (s->method->ssl3_enc->enc(s, 1) < 1)
-        goto err;
+        if (!SSL_USE_ETM(s) && mac_size != 0) {
+            if (s->method->ssl3_enc->mac(s, &wr[j],
+                    &(outbuf[j][wr[j].length + eivlen]), 1) < 0)
+                goto err;
+            SSL3_RECORD_add_length(&wr[j], mac_size);
+        }
 
-    if (SSL_USE_ETM(s) && mac_size != 0) {
-        if (s->method->ssl3_enc->mac(s, p + wr->length, 1) < 0)
-            goto err;
-        SSL3_RECORD_add_length(wr, mac_size);
+        SSL3_RECORD_set_data(&wr[j], outbuf[j]);
+        SSL3_RECORD_reset_input(&wr[j]);
+
+        if (eivlen) {
+            /*
+             * if (RAND_pseudo_bytes(p, eivlen) <= 0) goto err;
+             */
+            SSL3_RECORD_add_length(&wr[j], eivlen);
+        }
     }
 
-    /* record length after mac and block padding */
-    s2n(SSL3_RECORD_get_length(wr), plen);
+    if (s->method->ssl3_enc->enc(s, wr, numpipes, 1) < 1)
+        goto err;
 
-    if (s->msg_callback)
-        s->msg_callback(1, 0, SSL3_RT_HEADER, plen - 5, 5, s,
-                        s->msg_callback_arg);
+    for (j = 0; j < numpipes; j++) {
+        if (SSL_USE_ETM(s) && mac_size != 0) {
+            if (s->method->ssl3_enc->mac(s, &wr[j],
+                                         outbuf[j] + wr[j].length, 1) < 0)
+                goto err;
+            SSL3_RECORD_add_length(&wr[j], mac_size);
+        }
 
-    /*
-     * we should now have wr->data pointing to the encrypted data, which is
-     * wr->length long
-     */
-    SSL3_RECORD_set_type(wr, type);  /* not needed but helps for debugging */
-    SSL3_RECORD_add_length(wr, SSL3_RT_HEADER_LENGTH);
+        /* record length after mac and block padding */
+        s2n(SSL3_RECORD_get_length(&wr[j]), plen[j]);
+
+        if (s->msg_callback)
+            s->msg_callback(1, 0, SSL3_RT_HEADER, plen[j] - 5, 5, s,
+                            s->msg_callback_arg);
 
-    if (create_empty_fragment) {
         /*
-         * we are in a recursive call; just return the length, don't write
-         * out anything here
+         * we should now have wr->data pointing to the encrypted data, which is
+         * wr->length long
          */
-        return SSL3_RECORD_get_length(wr);
+        SSL3_RECORD_set_type(&wr[j], type); /* not needed but helps for debugging */
+        SSL3_RECORD_add_length(&wr[j], SSL3_RT_HEADER_LENGTH);
+
+        if (create_empty_fragment) {
+            /*
+             * we are in a recursive call; just return the length, don't write
+             * out anything here
+             */
+            if (j > 0) {
+                /* We should never be pipelining an empty fragment!! */
+                SSLerr(SSL_F_DO_SSL3_WRITEV, ERR_R_INTERNAL_ERROR);
+                goto err;
+            }
+            OPENSSL_free(compbuf);
+            return SSL3_RECORD_get_length(wr);
+        }
+
+        /* now let's set up wb */
+        SSL3_BUFFER_set_left(&s->rlayer.wbuf[j],
+                             held + prefix_len
+                             + SSL3_RECORD_get_length(&wr[j]));
     }
 
-    /* now let's set up wb */
-    SSL3_BUFFER_set_left(wb, prefix_len + SSL3_RECORD_get_length(wr));
+    /*
+     * Hold the records back while they fill less than the coalescing size.
+     * They count as written, and go out with later records or on SSL_flush()
+     */
+    if (type == SSL3_RT_APPLICATION_DATA && numpipes == 1
+            && SSL3_BUFFER_get_left(&s->rlayer.wbuf[0])
+               < s->write_coalesce_size) {
+        s->rlayer.wheld = 1;
+        OPENSSL_free(compbuf);
+        return totlen;
+    }
+    s->rlayer.wheld = 0;
 
     /*
      * memorize arguments so that ssl3_write_pending can detect bad write
      * retries later
      */
-    s->rlayer.wpend_tot = len;
+    s->rlayer.wpend_tot = totlen;
     s->rlayer.wpend_buf = buf;
     s->rlayer.wpend_type = type;
-    s->rlayer.wpend_ret = len;
+    s->rlayer.wpend_ret = totlen;
 
+    OPENSSL_free(compbuf);
     /* we now just need to write the buffer */
-    return ssl3_write_pending(s, type, buf, len);
+    return ssl3_write_pending(s, type, buf, totlen);
  err:
+    OPENSSL_free(compbuf);
     return -1;
 }
 
@@ -894,7 +1196,8 @@ int ssl3_write_pending(SSL *s, int type, const unsigned char *buf,
                        unsigned int len)
 {
     int i;
-    SSL3_BUFFER *wb = &s->rlayer.wbuf;
+    SSL3_BUFFER *wb = s->rlayer.wbuf;
+    unsigned int currbuf = 0;
 
 /* XXXX */
     if ((s->rlayer.wpend_tot > (int)len)
@@ -906,34 +1209,72 @@ int ssl3_write_pending(SSL *s, int type, const unsigned char *buf,
     }
 
     for (;;) {
+        /* Loop until we find a buffer we haven't written out yet */
+        if (SSL3_BUFFER_get_left(&wb[currbuf]) == 0) {
+            if (++currbuf < s->rlayer.numwpipes)
+                continue;
+            s->rwstate = SSL_NOTHING;
+            return (s->rlayer.wpend_ret);
+        }
         clear_sys_error();
         if (s->wbio != NULL) {
             s->rwstate = SSL_WRITING;
-            i = BIO_write(s->wbio,
-                (char *)&(SSL3_BUFFER_get_buf(wb)[SSL3_BUFFER_get_offset(wb)]),
-                (unsigned int)SSL3_BUFFER_get_left(wb));
+            i = BIO_write(s->wbio, (char *)
+                &(SSL3_BUFFER_get_buf(&wb[currbuf])
+                    [SSL3_BUFFER_get_offset(&wb[currbuf])]),
+                (unsigned int)SSL3_BUFFER_get_left(&wb[currbuf]));
         } else {
             SSLerr(SSL_F_SSL3_WRITE_PENDING, SSL_R_BIO_NOT_SET);
             i = -1;
         }
-        if (i == SSL3_BUFFER_get_left(wb)) {
-            SSL3_BUFFER_set_left(wb, 0);
-            SSL3_BUFFER_add_offset(wb, i);
-            s->rwstate = SSL_NOTHING;
-            return (s->rlayer.wpend_ret);
+        if (i == SSL3_BUFFER_get_left(&wb[currbuf])) {
+            SSL3_BUFFER_set_left(&wb[currbuf], 0);
+            SSL3_BUFFER_add_offset(&wb[currbuf], i);
+            continue;
         } else if (i <= 0) {
             if (SSL_IS_DTLS(s)) {
                 /*
                  * For DTLS, just drop it. That's kind of the whole point in
                  * using a datagram service
                  */
-                SSL3_BUFFER_set_left(wb, 0);
+                SSL3_BUFFER_set_left(&wb[currbuf], 0);
             }
             return (i);
         }
+        SSL3_BUFFER_add_offset(&wb[currbuf], i);
+        SSL3_BUFFER_add_left(&wb[currbuf], -i);
+    }
+}
+
+/*
+ * Write out the records held back by write coalescing. Returns 1 once they
+ * have all been written, or the failed BIO_write() result.
+ */
+int ssl3_write_held(SSL *s)
+{
+    SSL3_BUFFER *wb = &s->rlayer.wbuf[0];
+    int i;
+
+    while (s->rlayer.wheld) {
+        clear_sys_error();
+        if (s->wbio != NULL) {
+            s->rwstate = SSL_WRITING;
+            i = BIO_write(s->wbio, (char *)
+                &(SSL3_BUFFER_get_buf(wb)[SSL3_BUFFER_get_offset(wb)]),
+                (unsigned int)SSL3_BUFFER_get_left(wb));
+        } else {
+            SSLerr(SSL_F_SSL3_WRITE_HELD, SSL_R_BIO_NOT_SET);
+            i = -1;
+        }
+        if (i <= 0)
+            return i;
         SSL3_BUFFER_add_offset(wb, i);
         SSL3_BUFFER_add_left(wb, -i);
+        if (SSL3_BUFFER_get_left(wb) == 0)
+            s->rlayer.wheld = 0;
     }
+    s->rwstate = SSL_NOTHING;
+    return 1;
 }
 
 /*-
@@ -969,11 +1310,14 @@ int ssl3_read_bytes(SSL *s, int type, int *recvd_type, unsigned char *buf,
                     int len, int peek)
 {
     int al, i, j, ret;
-    unsigned int n;
+    unsigned int n, curr_rec, num_recs, read_bytes;
     SSL3_RECORD *rr;
+    SSL3_BUFFER *rbuf;
     void (*cb) (const SSL *ssl, int type2, int val) = NULL;
 
-    if (!SSL3_BUFFER_is_initialised(&s->rlayer.rbuf)) {
+    rbuf = &s->rlayer.rbuf;
+
+    if (!SSL3_BUFFER_is_initialised(rbuf)) {
         /* Not initialized yet */
         if (!ssl3_setup_read_buffer(s))
             return (-1);
@@ -1030,20 +1374,40 @@ int ssl3_read_bytes(SSL *s, int type, int *recvd_type, unsigned char *buf,
     s->rwstate = SSL_NOTHING;
 
     /*-
-     * s->s3->rrec.type         - is the type of record
-     * s->s3->rrec.data,    - data
-     * s->s3->rrec.off,     - offset into 'data' for next read
-     * s->s3->rrec.length,  - number of bytes.
+     * For each record 'i' up to |num_recs|
+     * rr[i].type     - is the type of record
+     * rr[i].data,    - data
+     * rr[i].off,     - offset into 'data' for next read
+     * rr[i].length,  - number of bytes.
+     * A record is used up once its length drops to zero.
      */
-    rr = &s->rlayer.rrec;
-
-    /* get new packet if necessary */
-    if ((SSL3_RECORD_get_length(rr) == 0)
-            || (s->rlayer.rstate == SSL_ST_READ_BODY)) {
-        ret = ssl3_get_record(s);
-        if (ret <= 0)
-            return (ret);
-    }
+    rr = s->rlayer.rrec;
+    num_recs = RECORD_LAYER_get_numrpipes(&s->rlayer);
+
+    do {
+        /* get new records if necessary */
+        if (num_recs == 0) {
+            ret = ssl3_get_record(s);
+            if (ret <= 0)
+                return (ret);
+            num_recs = RECORD_LAYER_get_numrpipes(&s->rlayer);
+            if (num_recs == 0) {
+                /* Shouldn't happen */
+                al = SSL_AD_INTERNAL_ERROR;
+                SSLerr(SSL_F_SSL3_READ_BYTES, ERR_R_INTERNAL_ERROR);
+                goto f_err;
+            }
+        }
+        /* Skip over any records we have already read */
+        for (curr_rec = 0;
+             curr_rec < num_recs && SSL3_RECORD_get_length(&rr[curr_rec]) == 0;
+             curr_rec++) ;
+        if (curr_rec == num_recs) {
+            RECORD_LAYER_set_numrpipes(&s->rlayer, 0);
+            num_recs = 0;
+        }
+    } while (num_recs == 0);
+    rr = &rr[curr_rec];
 
     /* we now have a packet which can be read and processed */
 
@@ -1061,6 +1425,7 @@ int ssl3_read_bytes(SSL *s, int type, int *recvd_type, unsigned char *buf,
      */
     if (s->shutdown & SSL_RECEIVED_SHUTDOWN) {
         SSL3_RECORD_set_length(rr, 0);
+        RECORD_LAYER_set_numrpipes(&s->rlayer, 0);
         s->rwstate = SSL_NOTHING;
         return (0);
     }
@@ -1098,24 +1463,42 @@ int ssl3_read_bytes(SSL *s, int type, int *recvd_type, unsigned char *buf,
         if (len <= 0)
             return (len);
 
-        if ((unsigned int)len > SSL3_RECORD_get_length(rr))
-            n = SSL3_RECORD_get_length(rr);
-        else
-            n = (unsigned int)len;
-
-        memcpy(buf, &(rr->data[rr->off]), n);
-        if (!peek) {
-            SSL3_RECORD_add_length(rr, -n);
-            SSL3_RECORD_add_off(rr, n);
-            if (SSL3_RECORD_get_length(rr) == 0) {
-                s->rlayer.rstate = SSL_ST_READ_HEADER;
-                SSL3_RECORD_set_off(rr, 0);
-                if (s->mode & SSL_MODE_RELEASE_BUFFERS
-                    && SSL3_BUFFER_get_left(&s->rlayer.rbuf) == 0)
-                    ssl3_release_read_buffer(s);
+        /*
+         * Application data may be returned from several decoded records in
+         * one go, anything else comes from the current record only
+         */
+        read_bytes = 0;
+        do {
+            if ((unsigned int)len - read_bytes > SSL3_RECORD_get_length(rr))
+                n = SSL3_RECORD_get_length(rr);
+            else
+                n = (unsigned int)len - read_bytes;
+
+            memcpy(buf, &(rr->data[rr->off]), n);
+            buf += n;
+            if (!peek) {
+                SSL3_RECORD_add_length(rr, -n);
+                SSL3_RECORD_add_off(rr, n);
+                if (SSL3_RECORD_get_length(rr) == 0) {
+                    s->rlayer.rstate = SSL_ST_READ_HEADER;
+                    SSL3_RECORD_set_off(rr, 0);
+                }
             }
+            if (SSL3_RECORD_get_length(rr) == 0
+                || (peek && n == SSL3_RECORD_get_length(rr))) {
+                curr_rec++;
+                rr++;
+            }
+            read_bytes += n;
+        } while (type == SSL3_RT_APPLICATION_DATA && curr_rec < num_recs
+                 && read_bytes < (unsigned int)len);
+        if (!peek && curr_rec == num_recs) {
+            RECORD_LAYER_set_numrpipes(&s->rlayer, 0);
+            if (s->mode & SSL_MODE_RELEASE_BUFFERS
+                && SSL3_BUFFER_get_left(rbuf) == 0)
+                ssl3_release_read_buffer(s);
         }
-        return (n);
+        return (int)read_bytes;
     }
 
     /*
@@ -1284,12 +1667,13 @@ int ssl3_read_bytes(SSL *s, int type, int *recvd_type, unsigned char *buf,
      */
     if (s->server &&
         SSL_is_init_finished(s) &&
-        !s->s3->send_connection_binding &&
         (s->version > SSL3_VERSION) &&
         (s->rlayer.handshake_fragment_len >= 4) &&
         (s->rlayer.handshake_fragment[0] == SSL3_MT_CLIENT_HELLO) &&
         (s->session != NULL) && (s->session->cipher != NULL) &&
-        !(s->ctx->options & SSL_OP_ALLOW_UNSAFE_LEGACY_RENEGOTIATION)) {
+        ((!s->s3->send_connection_binding &&
+          !(s->ctx->options & SSL_OP_ALLOW_UNSAFE_LEGACY_RENEGOTIATION)) ||
+         (s->s3->flags & SSL3_FLAGS_NO_RENEGOTIATE_CIPHERS))) {
         SSL3_RECORD_set_length(rr, 0);
         ssl3_send_alert(s, SSL3_AL_WARNING, SSL_AD_NO_RENEGOTIATION);
         goto start;
@@ -1475,7 +1859,7 @@ void ssl3_record_sequence_update(unsigned char *seq)
  */
 int RECORD_LAYER_is_sslv2_record(RECORD_LAYER *rl)
 {
-    return SSL3_RECORD_is_sslv2_record(&rl->rrec);
+    return SSL3_RECORD_is_sslv2_record(&rl->rrec[0]);
 }
 
 /*
@@ -1483,5 +1867,5 @@ int RECORD_LAYER_is_sslv2_record(RECORD_LAYER *rl)
  */
 unsigned int RECORD_LAYER_get_rrec_length(RECORD_LAYER *rl)
 {
-    return SSL3_RECORD_get_length(&rl->rrec);
+    return SSL3_RECORD_get_length(&rl->rrec[0]);
 }
@@ -125,6 +125,8 @@ typedef struct ssl3_buffer_st {
     int offset;
     /* how many bytes left */
     int left;
+    /* size to allocate if larger than one record, or 0 */
+    size_t default_len;
 } SSL3_BUFFER;
 
 #define SEQ_NUM_SIZE                            8
@@ -255,12 +257,14 @@ typedef struct record_layer_st {
     int rstate;
     /* read IO goes into here */
     SSL3_BUFFER rbuf;
-    /* write IO goes into here */
-    SSL3_BUFFER wbuf;
+    /* number of write buffers allocated in wbuf */
+    unsigned int numwpipes;
+    /* write IO goes into here, one buffer per pipeline */
+    SSL3_BUFFER wbuf[SSL_MAX_PIPELINES];
+    /* number of records decoded into rrec by the last ssl3_get_record() */
+    unsigned int numrpipes;
     /* each decoded record goes in here */
-    SSL3_RECORD rrec;
-    /* goes out from here */
-    SSL3_RECORD wrec;
+    SSL3_RECORD rrec[SSL_MAX_PIPELINES];
 
     /* used internally to point at a raw packet */
     unsigned char *packet;
@@ -285,6 +289,8 @@ typedef struct record_layer_st {
     /* number of bytes submitted */
     int wpend_ret;
     const unsigned char *wpend_buf;
+    /* wbuf[0] holds records back for write coalescing */
+    int wheld;
 
     unsigned char read_sequence[SEQ_NUM_SIZE];
     unsigned char write_sequence[SEQ_NUM_SIZE];
@@ -304,9 +310,14 @@ typedef struct record_layer_st {
 
 #define RECORD_LAYER_set_read_ahead(rl, ra)     ((rl)->read_ahead = (ra))
 #define RECORD_LAYER_get_read_ahead(rl)         ((rl)->read_ahead)
+#define RECORD_LAYER_set_default_read_buffer_len(rl, l) \
+                                                ((rl)->rbuf.default_len = (l))
 #define RECORD_LAYER_get_packet(rl)             ((rl)->packet)
 #define RECORD_LAYER_get_packet_length(rl)      ((rl)->packet_length)
 #define RECORD_LAYER_add_packet_length(rl, inc) ((rl)->packet_length += (inc))
+#define RECORD_LAYER_get_numrpipes(rl)          ((rl)->numrpipes)
+#define RECORD_LAYER_get_write_sequence(rl)     ((rl)->write_sequence)
+#define RECORD_LAYER_get_read_sequence(rl)      ((rl)->read_sequence)
 #define DTLS_RECORD_LAYER_get_w_epoch(rl)       ((rl)->d->w_epoch)
 #define DTLS_RECORD_LAYER_get_processed_rcds(rl) \
                                                 ((rl)->d->processed_rcds)
@@ -316,7 +327,7 @@ typedef struct record_layer_st {
 void RECORD_LAYER_init(RECORD_LAYER *rl, SSL *s);
 void RECORD_LAYER_clear(RECORD_LAYER *rl);
 void RECORD_LAYER_release(RECORD_LAYER *rl);
-int RECORD_LAYER_read_pending(RECORD_LAYER *rl);
+int RECORD_LAYER_read_pending(const RECORD_LAYER *rl);
 int RECORD_LAYER_write_pending(RECORD_LAYER *rl);
 int RECORD_LAYER_set_data(RECORD_LAYER *rl, const unsigned char *buf, int len);
 void RECORD_LAYER_reset_read_sequence(RECORD_LAYER *rl);
@@ -327,16 +338,27 @@ unsigned int RECORD_LAYER_get_rrec_length(RECORD_LAYER *rl);
 __owur int ssl3_pending(const SSL *s);
 __owur int ssl3_write_bytes(SSL *s, int type, const void *buf, int len);
 __owur int do_ssl3_write(SSL *s, int type, const unsigned char *buf,
-                         unsigned int len, int create_empty_fragment);
+                         unsigned int *pipelens, unsigned int numpipes,
+                         int create_empty_fragment);
+__owur int ssl3_writev_bytes(SSL *s, int type, const SSL_IOVEC *iov,
+                             unsigned int iovcnt, int len);
+__owur int do_ssl3_writev(SSL *s, int type, const SSL_IOVEC *iov,
+                          unsigned int iovcnt, size_t off,
+                          const unsigned char *buf, unsigned int *pipelens,
+                          unsigned int numpipes, int create_empty_fragment);
 __owur int ssl3_read_bytes(SSL *s, int type, int *recvd_type,
                            unsigned char *buf, int len, int peek);
 __owur int ssl3_setup_buffers(SSL *s);
-__owur int ssl3_enc(SSL *s, int send_data);
-__owur int n_ssl3_mac(SSL *ssl, unsigned char *md, int send_data);
+__owur int ssl3_enc(SSL *s, SSL3_RECORD *inrecs, unsigned int n_recs,
+                    int send);
+__owur int n_ssl3_mac(SSL *ssl, SSL3_RECORD *rec, unsigned char *md,
+                      int send);
 __owur int ssl3_write_pending(SSL *s, int type, const unsigned char *buf,
                        unsigned int len);
-__owur int tls1_enc(SSL *s, int snd);
-__owur int tls1_mac(SSL *ssl, unsigned char *md, int snd);
+__owur int ssl3_write_held(SSL *s);
+__owur int tls1_enc(SSL *s, SSL3_RECORD *recs, unsigned int n_recs,
+                    int send);
+__owur int tls1_mac(SSL *ssl, SSL3_RECORD *rec, unsigned char *md, int send);
 int DTLS_RECORD_LAYER_new(RECORD_LAYER *rl);
 void DTLS_RECORD_LAYER_free(RECORD_LAYER *rl);
 void DTLS_RECORD_LAYER_clear(RECORD_LAYER *rl);
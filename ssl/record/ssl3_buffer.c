@@ -126,11 +126,12 @@ void SSL3_BUFFER_set_data(SSL3_BUFFER *b, const unsigned char *d, int n)
 void SSL3_BUFFER_clear(SSL3_BUFFER *b)
 {
     unsigned char *buf = b->buf;
-    size_t len = b->len;
+    size_t len = b->len, default_len = b->default_len;
 
     memset(b, 0, sizeof(*b));
     b->buf = buf;
     b->len = len;
+    b->default_len = default_len;
 }
 
 void SSL3_BUFFER_release(SSL3_BUFFER *b)
@@ -163,6 +164,9 @@ int ssl3_setup_read_buffer(SSL *s)
         if (ssl_allow_compression(s))
             len += SSL3_RT_MAX_COMPRESSED_OVERHEAD;
 #endif
+        /* A larger buffer lets read_ahead fetch several records at once */
+        if (b->default_len > len)
+            len = b->default_len;
         if ((p = OPENSSL_malloc(len)) == NULL)
             goto err;
         b->buf = p;
@@ -177,24 +181,27 @@ int ssl3_setup_read_buffer(SSL *s)
     return 0;
 }
 
-int ssl3_setup_write_buffer(SSL *s)
+int ssl3_setup_write_buffer(SSL *s, unsigned int numwpipes, size_t len)
 {
     unsigned char *p;
-    size_t len, align = 0, headerlen;
+    size_t align = 0, headerlen, coalesce = 0;
     SSL3_BUFFER *wb;
+    unsigned int currpipe;
 
-    wb = RECORD_LAYER_get_wbuf(&s->rlayer);
+    if (len == 0) {
+        /* Coalesced records are held in the first buffer */
+        if (!SSL_IS_DTLS(s))
+            coalesce = s->write_coalesce_size;
 
-    if (SSL_IS_DTLS(s))
-        headerlen = DTLS1_RT_HEADER_LENGTH + 1;
-    else
-        headerlen = SSL3_RT_HEADER_LENGTH;
+        if (SSL_IS_DTLS(s))
+            headerlen = DTLS1_RT_HEADER_LENGTH + 1;
+        else
+            headerlen = SSL3_RT_HEADER_LENGTH;
 
 #if defined(SSL3_ALIGN_PAYLOAD) && SSL3_ALIGN_PAYLOAD!=0
-    align = (-SSL3_RT_HEADER_LENGTH) & (SSL3_ALIGN_PAYLOAD - 1);
+        align = (-SSL3_RT_HEADER_LENGTH) & (SSL3_ALIGN_PAYLOAD - 1);
 #endif
 
-    if (wb->buf == NULL) {
         len = s->max_send_fragment
             + SSL3_RT_SEND_MAX_ENCRYPTED_OVERHEAD + headerlen + align;
 #ifndef OPENSSL_NO_COMP
@@ -203,12 +210,23 @@ int ssl3_setup_write_buffer(SSL *s)
 #endif
         if (!(s->options & SSL_OP_DONT_INSERT_EMPTY_FRAGMENTS))
             len += headerlen + align + SSL3_RT_SEND_MAX_ENCRYPTED_OVERHEAD;
+    }
 
-        if ((p = OPENSSL_malloc(len)) == NULL)
-            goto err;
-        wb->buf = p;
-        wb->len = len;
+    wb = RECORD_LAYER_get_wbuf(&s->rlayer);
+    for (currpipe = 0; currpipe < numwpipes; currpipe++) {
+        if (wb[currpipe].buf == NULL) {
+            size_t thislen = currpipe == 0 ? len + coalesce : len;
+
+            if ((p = OPENSSL_malloc(thislen)) == NULL)
+                goto err;
+            memset(&wb[currpipe], 0, sizeof(wb[currpipe]));
+            wb[currpipe].buf = p;
+            wb[currpipe].len = thislen;
+        }
     }
+    /* Never drop a buffer that may still hold unwritten data */
+    if (s->rlayer.numwpipes < numwpipes)
+        s->rlayer.numwpipes = numwpipes;
 
     return 1;
 
@@ -221,7 +239,7 @@ int ssl3_setup_buffers(SSL *s)
 {
     if (!ssl3_setup_read_buffer(s))
         return 0;
-    if (!ssl3_setup_write_buffer(s))
+    if (!ssl3_setup_write_buffer(s, 1, 0))
         return 0;
     return 1;
 }
@@ -229,11 +247,18 @@ int ssl3_setup_buffers(SSL *s)
 int ssl3_release_write_buffer(SSL *s)
 {
     SSL3_BUFFER *wb;
+    unsigned int pipes;
 
+    /*
+     * Buffers past numwpipes may still be allocated when a later write used
+     * fewer pipelines, so release all of them.
+     */
     wb = RECORD_LAYER_get_wbuf(&s->rlayer);
-
-    OPENSSL_free(wb->buf);
-    wb->buf = NULL;
+    for (pipes = 0; pipes < SSL_MAX_PIPELINES; pipes++) {
+        OPENSSL_free(wb[pipes].buf);
+        wb[pipes].buf = NULL;
+    }
+    s->rlayer.numwpipes = 0;
     return 1;
 }
 
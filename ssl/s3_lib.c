@@ -3384,8 +3384,10 @@ void ssl3_free(SSL *s)
 
     sk_X509_NAME_pop_free(s->s3->tmp.ca_names, X509_NAME_free);
     OPENSSL_free(s->s3->tmp.ciphers_raw);
+    OPENSSL_free(s->s3->tmp.clienthello_exts);
     OPENSSL_clear_free(s->s3->tmp.pms, s->s3->tmp.pmslen);
     OPENSSL_free(s->s3->tmp.peer_sigalgs);
+    OPENSSL_free(s->s3->tmp.shared_sigalgs);
     ssl3_free_digest_list(s);
     OPENSSL_free(s->s3->alpn_selected);
 
@@ -3402,10 +3404,14 @@ void ssl3_clear(SSL *s)
     sk_X509_NAME_pop_free(s->s3->tmp.ca_names, X509_NAME_free);
     OPENSSL_free(s->s3->tmp.ciphers_raw);
     s->s3->tmp.ciphers_raw = NULL;
+    OPENSSL_free(s->s3->tmp.clienthello_exts);
+    s->s3->tmp.clienthello_exts = NULL;
     OPENSSL_clear_free(s->s3->tmp.pms, s->s3->tmp.pmslen);
     s->s3->tmp.pms = NULL;
     OPENSSL_free(s->s3->tmp.peer_sigalgs);
     s->s3->tmp.peer_sigalgs = NULL;
+    OPENSSL_free(s->s3->tmp.shared_sigalgs);
+    s->s3->tmp.shared_sigalgs = NULL;
 
 #ifndef OPENSSL_NO_EC
     s->s3->is_probably_safari = 0;
@@ -3451,10 +3457,39 @@ static char *srp_password_from_info_cb(SSL *s, void *arg)
 static int ssl3_set_req_cert_type(CERT *c, const unsigned char *p,
                                   size_t len);
 
+/*
+ * Commands which change the CERT: an SSL or SSL_CTX must stop sharing its
+ * CERT before any of these are applied to it.
+ */
+static int ssl3_ctrl_changes_cert(int cmd)
+{
+    switch (cmd) {
+    case SSL_CTRL_SET_TMP_DH:
+    case SSL_CTRL_SET_DH_AUTO:
+    case SSL_CTRL_CHAIN:
+    case SSL_CTRL_CHAIN_CERT:
+    case SSL_CTRL_SELECT_CURRENT_CERT:
+    case SSL_CTRL_SET_SIGALGS:
+    case SSL_CTRL_SET_SIGALGS_LIST:
+    case SSL_CTRL_SET_CLIENT_SIGALGS:
+    case SSL_CTRL_SET_CLIENT_SIGALGS_LIST:
+    case SSL_CTRL_SET_CLIENT_CERT_TYPES:
+    case SSL_CTRL_BUILD_CERT_CHAIN:
+    case SSL_CTRL_SET_VERIFY_CERT_STORE:
+    case SSL_CTRL_SET_CHAIN_CERT_STORE:
+        return 1;
+    default:
+        return 0;
+    }
+}
+
 long ssl3_ctrl(SSL *s, int cmd, long larg, void *parg)
 {
     int ret = 0;
 
+    if (ssl3_ctrl_changes_cert(cmd) && !ssl_cert_unshare(&s->cert))
+        return 0;
+
     switch (cmd) {
     case SSL_CTRL_GET_SESSION_REUSED:
         ret = s->hit;
@@ -3655,9 +3690,10 @@ long ssl3_ctrl(SSL *s, int cmd, long larg, void *parg)
             cpk = ssl_get_server_send_pkey(s);
             if (!cpk)
                 return 0;
-            s->cert->key = cpk;
-            return 1;
+            return ssl_cert_set_key(&s->cert, cpk);
         }
+        if (!ssl_cert_unshare(&s->cert))
+            return 0;
         return ssl_cert_set_current(s->cert, larg);
 
 #ifndef OPENSSL_NO_EC
@@ -3794,6 +3830,8 @@ long ssl3_callback_ctrl(SSL *s, int cmd, void (*fp) (void))
 #ifndef OPENSSL_NO_DH
     case SSL_CTRL_SET_TMP_DH_CB:
         {
+            if (!ssl_cert_unshare(&s->cert))
+                return 0;
             s->cert->dh_tmp_cb = (DH *(*)(SSL *, int, int))fp;
         }
         break;
@@ -3816,6 +3854,10 @@ long ssl3_callback_ctrl(SSL *s, int cmd, void (*fp) (void))
 
 long ssl3_ctx_ctrl(SSL_CTX *ctx, int cmd, long larg, void *parg)
 {
+    if ((ssl3_ctrl_changes_cert(cmd) || cmd == SSL_CTRL_SET_CURRENT_CERT)
+        && !ssl_cert_unshare(&ctx->cert))
+        return 0;
+
     switch (cmd) {
 #ifndef OPENSSL_NO_DH
     case SSL_CTRL_SET_TMP_DH:
@@ -3891,15 +3933,13 @@ long ssl3_ctx_ctrl(SSL_CTX *ctx, int cmd, long larg, void *parg)
                 return 0;
             }
             if (cmd == SSL_CTRL_SET_TLSEXT_TICKET_KEYS) {
-                memcpy(ctx->tlsext_tick_key_name, keys, 16);
-                memcpy(ctx->tlsext_tick_hmac_key, keys + 16, 16);
-                memcpy(ctx->tlsext_tick_aes_key, keys + 32, 16);
-            } else {
-                memcpy(keys, ctx->tlsext_tick_key_name, 16);
-                memcpy(keys + 16, ctx->tlsext_tick_hmac_key, 16);
-                memcpy(keys + 32, ctx->tlsext_tick_aes_key, 16);
+                if (!tls1_ticket_ring_push(ctx, keys, 1)) {
+                    SSLerr(SSL_F_SSL3_CTX_CTRL, ERR_R_MALLOC_FAILURE);
+                    return 0;
+                }
+                return 1;
             }
-            return 1;
+            return tls1_ticket_ring_get(ctx, keys);
         }
 
     case SSL_CTRL_SET_TLSEXT_STATUS_REQ_CB_ARG:
@@ -4028,6 +4068,8 @@ long ssl3_ctx_callback_ctrl(SSL_CTX *ctx, int cmd, void (*fp) (void))
 #ifndef OPENSSL_NO_DH
     case SSL_CTRL_SET_TMP_DH_CB:
         {
+            if (!ssl_cert_unshare(&ctx->cert))
+                return 0;
             ctx->cert->dh_tmp_cb = (DH *(*)(SSL *, int, int))fp;
         }
         break;
@@ -4298,6 +4340,13 @@ int ssl3_shutdown(SSL *s)
 {
     int ret;
 
+    /*
+     * Records held back by write coalescing go out first, even if no
+     * close_notify is sent after them
+     */
+    if (ssl3_write_held(s) <= 0)
+        return -1;              /* return WANT_WRITE */
+
     /*
      * Don't do anything much if we have not done the handshake or we don't
      * want to send messages :-)
@@ -4369,6 +4418,20 @@ int ssl3_write(SSL *s, const void *buf, int len)
                                          buf, len);
 }
 
+int ssl3_writev(SSL *s, const SSL_IOVEC *iov, int iovcnt)
+{
+    int i, len = 0;
+
+    clear_sys_error();
+    if (s->s3->renegotiate)
+        ssl3_renegotiate_check(s);
+
+    /* SSL_writev() made sure this fits */
+    for (i = 0; i < iovcnt; i++)
+        len += (int)iov[i].len;
+    return ssl3_writev_bytes(s, SSL3_RT_APPLICATION_DATA, iov, iovcnt, len);
+}
+
 static int ssl3_read_internal(SSL *s, void *buf, int len, int peek)
 {
     int ret;
@@ -134,5 +134,6 @@ int SSL_library_init(void)
     /* initialize cipher/digest methods table */
     ssl_load_ciphers();
     SSL_add_ssl_module();
+    OBJ_NAME_freeze();
     return (1);
 }
@@ -259,8 +259,6 @@ CERT *ssl_cert_dup(CERT *cert)
         ret->client_sigalgslen = cert->client_sigalgslen;
     } else
         ret->client_sigalgs = NULL;
-    /* Shared sigalgs also NULL */
-    ret->shared_sigalgs = NULL;
     /* Copy any custom client certificate types */
     if (cert->ctypes) {
         ret->ctypes = OPENSSL_malloc(cert->ctype_num);
@@ -309,6 +307,41 @@ CERT *ssl_cert_dup(CERT *cert)
     return NULL;
 }
 
+/*
+ * An SSL shares its SSL_CTX's CERT until one of them changes it: anything
+ * about to modify |*pc| calls this first to swap in a private copy if the
+ * CERT is still shared. Other SSLs may be dropping their references at the
+ * same time, so the count is read under the lock.
+ */
+int ssl_cert_unshare(CERT **pc)
+{
+    CERT *c;
+
+    if (CRYPTO_add(&(*pc)->references, 0, CRYPTO_LOCK_SSL_CERT) == 1)
+        return 1;
+    if ((c = ssl_cert_dup(*pc)) == NULL)
+        return 0;
+    ssl_cert_free(*pc);
+    *pc = c;
+    return 1;
+}
+
+/*
+ * Make |cpk|, one of (*pc)->pkeys, the current key: during handshakes this
+ * usually is the current key already, and then a shared CERT stays shared.
+ */
+int ssl_cert_set_key(CERT **pc, CERT_PKEY *cpk)
+{
+    size_t idx = cpk - (*pc)->pkeys;
+
+    if ((*pc)->key == cpk)
+        return 1;
+    if (!ssl_cert_unshare(pc))
+        return 0;
+    (*pc)->key = &(*pc)->pkeys[idx];
+    return 1;
+}
+
 /* Free up and clear all certificates and chains */
 
 void ssl_cert_clear_certs(CERT *c)
@@ -357,7 +390,6 @@ void ssl_cert_free(CERT *c)
     ssl_cert_clear_certs(c);
     OPENSSL_free(c->conf_sigalgs);
     OPENSSL_free(c->client_sigalgs);
-    OPENSSL_free(c->shared_sigalgs);
     OPENSSL_free(c->ctypes);
     X509_STORE_free(c->verify_store);
     X509_STORE_free(c->chain_store);
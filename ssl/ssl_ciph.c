@@ -1069,7 +1069,7 @@ static int ssl_cipher_strength_sort(CIPHER_ORDER **head_p,
 static int ssl_cipher_process_rulestr(const char *rule_str,
                                       CIPHER_ORDER **head_p,
                                       CIPHER_ORDER **tail_p,
-                                      const SSL_CIPHER **ca_list, CERT *c)
+                                      const SSL_CIPHER **ca_list, CERT **pc)
 {
     uint32_t alg_mkey, alg_auth, alg_enc, alg_mac, alg_ssl, algo_strength;
     const char *l, *buf;
@@ -1289,8 +1289,9 @@ static int ssl_cipher_process_rulestr(const char *rule_str,
                 if (level < 0 || level > 5) {
                     SSLerr(SSL_F_SSL_CIPHER_PROCESS_RULESTR,
                            SSL_R_INVALID_COMMAND);
-                } else {
-                    c->sec_level = level;
+                } else if ((*pc)->sec_level == level
+                           || ssl_cert_unshare(pc)) {
+                    (*pc)->sec_level = level;
                     ok = 1;
                 }
             } else
@@ -1323,10 +1324,11 @@ static int ssl_cipher_process_rulestr(const char *rule_str,
 }
 
 #ifndef OPENSSL_NO_EC
-static int check_suiteb_cipher_list(const SSL_METHOD *meth, CERT *c,
+static int check_suiteb_cipher_list(const SSL_METHOD *meth, CERT **pc,
                                     const char **prule_str)
 {
     unsigned int suiteb_flags = 0, suiteb_comb2 = 0;
+    CERT *c = *pc;
     if (strncmp(*prule_str, "SUITEB128ONLY", 13) == 0) {
         suiteb_flags = SSL_CERT_FLAG_SUITEB_128_LOS_ONLY;
     } else if (strncmp(*prule_str, "SUITEB128C2", 11) == 0) {
@@ -1339,6 +1341,11 @@ static int check_suiteb_cipher_list(const SSL_METHOD *meth, CERT *c,
     }
 
     if (suiteb_flags) {
+        if ((c->cert_flags & SSL_CERT_FLAG_SUITEB_128_LOS) != suiteb_flags) {
+            if (!ssl_cert_unshare(pc))
+                return 0;
+            c = *pc;
+        }
         c->cert_flags &= ~SSL_CERT_FLAG_SUITEB_128_LOS;
         c->cert_flags |= suiteb_flags;
     } else
@@ -1381,7 +1388,7 @@ static int check_suiteb_cipher_list(const SSL_METHOD *meth, CERT *c,
 STACK_OF(SSL_CIPHER) *ssl_create_cipher_list(const SSL_METHOD *ssl_method, STACK_OF(SSL_CIPHER)
                                              **cipher_list, STACK_OF(SSL_CIPHER)
                                              **cipher_list_by_id,
-                                             const char *rule_str, CERT *c)
+                                             const char *rule_str, CERT **pc)
 {
     int ok, num_of_ciphers, num_of_alias_max, num_of_group_aliases;
     uint32_t disabled_mkey, disabled_auth, disabled_enc, disabled_mac,
@@ -1397,7 +1404,7 @@ STACK_OF(SSL_CIPHER) *ssl_create_cipher_list(const SSL_METHOD *ssl_method, STACK
     if (rule_str == NULL || cipher_list == NULL || cipher_list_by_id == NULL)
         return NULL;
 #ifndef OPENSSL_NO_EC
-    if (!check_suiteb_cipher_list(ssl_method, c, &rule_str))
+    if (!check_suiteb_cipher_list(ssl_method, pc, &rule_str))
         return NULL;
 #endif
 
@@ -1516,14 +1523,14 @@ STACK_OF(SSL_CIPHER) *ssl_create_cipher_list(const SSL_METHOD *ssl_method, STACK
     rule_p = rule_str;
     if (strncmp(rule_str, "DEFAULT", 7) == 0) {
         ok = ssl_cipher_process_rulestr(SSL_DEFAULT_CIPHER_LIST,
-                                        &head, &tail, ca_list, c);
+                                        &head, &tail, ca_list, pc);
         rule_p += 7;
         if (*rule_p == ':')
             rule_p++;
     }
 
     if (ok && (strlen(rule_p) > 0))
-        ok = ssl_cipher_process_rulestr(rule_p, &head, &tail, ca_list, c);
+        ok = ssl_cipher_process_rulestr(rule_p, &head, &tail, ca_list, pc);
 
     OPENSSL_free(ca_list); /* Not needed anymore */
 
@@ -138,8 +138,6 @@ struct ssl_conf_ctx_st {
     uint32_t *poptions;
     /* Certificate filenames for each type */
     char *cert_filename[SSL_PKEY_NUM];
-    /* Pointer to SSL or SSL_CTX cert_flags or NULL if none */
-    uint32_t *pcert_flags;
     /* Pointer to SSL or SSL_CTX verify_mode or NULL if none */
     uint32_t *pvfy_flags;
     /* Pointer to SSL or SSL_CTX min_version field or NULL if none */
@@ -165,8 +163,14 @@ static void ssl_set_option(SSL_CONF_CTX *cctx, unsigned int name_flags,
     switch (name_flags & SSL_TFLAG_TYPE_MASK) {
 
     case SSL_TFLAG_CERT:
-        pflags = cctx->pcert_flags;
-        break;
+        /* The CERT may be shared: let the ctrl take a private copy */
+        if (cctx->ctx)
+            SSL_CTX_ctrl(cctx->ctx, onoff ? SSL_CTRL_CERT_FLAGS
+                         : SSL_CTRL_CLEAR_CERT_FLAGS, option_value, NULL);
+        else if (cctx->ssl)
+            SSL_ctrl(cctx->ssl, onoff ? SSL_CTRL_CERT_FLAGS
+                     : SSL_CTRL_CLEAR_CERT_FLAGS, option_value, NULL);
+        return;
 
     case SSL_TFLAG_VFY:
         pflags =  cctx->pvfy_flags;
@@ -473,14 +477,18 @@ static int cmd_ServerInfoFile(SSL_CONF_CTX *cctx, const char *value)
 static int do_store(SSL_CONF_CTX *cctx,
                     const char *CAfile, const char *CApath, int verify_store)
 {
+    CERT **pcert;
     CERT *cert;
     X509_STORE **st;
     if (cctx->ctx)
-        cert = cctx->ctx->cert;
+        pcert = &cctx->ctx->cert;
     else if (cctx->ssl)
-        cert = cctx->ssl->cert;
+        pcert = &cctx->ssl->cert;
     else
         return 1;
+    if (!ssl_cert_unshare(pcert))
+        return 0;
+    cert = *pcert;
     st = verify_store ? &cert->verify_store : &cert->chain_store;
     if (*st == NULL) {
         *st = X509_STORE_new();
@@ -909,13 +917,11 @@ void SSL_CONF_CTX_set_ssl(SSL_CONF_CTX *cctx, SSL *ssl)
         cctx->poptions = &ssl->options;
         cctx->min_version = &ssl->min_proto_version;
         cctx->max_version = &ssl->max_proto_version;
-        cctx->pcert_flags = &ssl->cert->cert_flags;
         cctx->pvfy_flags = &ssl->verify_mode;
     } else {
         cctx->poptions = NULL;
         cctx->min_version = NULL;
         cctx->max_version = NULL;
-        cctx->pcert_flags = NULL;
         cctx->pvfy_flags = NULL;
     }
 }
@@ -928,13 +934,11 @@ void SSL_CONF_CTX_set_ssl_ctx(SSL_CONF_CTX *cctx, SSL_CTX *ctx)
         cctx->poptions = &ctx->options;
         cctx->min_version = &ctx->min_proto_version;
         cctx->max_version = &ctx->max_proto_version;
-        cctx->pcert_flags = &ctx->cert->cert_flags;
         cctx->pvfy_flags = &ctx->verify_mode;
     } else {
         cctx->poptions = NULL;
         cctx->min_version = NULL;
         cctx->max_version = NULL;
-        cctx->pcert_flags = NULL;
         cctx->pvfy_flags = NULL;
     }
 }
@@ -146,7 +146,9 @@
 # include <assert.h>
 #endif
 #include <stdio.h>
+#include <limits.h>
 #include "ssl_locl.h"
+#include "internal/ktls.h"
 #include <openssl/objects.h>
 #include <openssl/lhash.h>
 #include <openssl/x509v3.h>
@@ -167,8 +169,9 @@ SSL3_ENC_METHOD ssl3_undef_enc_method = {
      * evil casts, but these functions are only called if there's a library
      * bug
      */
-    (int (*)(SSL *, int))ssl_undefined_function,
-    (int (*)(SSL *, unsigned char *, int))ssl_undefined_function,
+    (int (*)(SSL *, SSL3_RECORD *, unsigned int, int))ssl_undefined_function,
+    (int (*)(SSL *, SSL3_RECORD *, unsigned char *, int))
+        ssl_undefined_function,
     ssl_undefined_function,
     (int (*)(SSL *, unsigned char *, unsigned char *, int))
         ssl_undefined_function,
@@ -194,7 +197,12 @@ struct ssl_async_args {
     union {
         int (*func1)(SSL *, void *, int);
         int (*func2)(SSL *, const void *, int);
+        int (*func3)(SSL *, const SSL_IOVEC *, int);
     } f;
+    /* For the SSL_sendfile() fallback */
+    int fd;
+    off_t offset;
+    size_t size;
 };
 
 static const struct {
@@ -601,7 +609,7 @@ int SSL_CTX_set_ssl_version(SSL_CTX *ctx, const SSL_METHOD *meth)
 
     sk = ssl_create_cipher_list(ctx->method, &(ctx->cipher_list),
                                 &(ctx->cipher_list_by_id),
-                                SSL_DEFAULT_CIPHER_LIST, ctx->cert);
+                                SSL_DEFAULT_CIPHER_LIST, &ctx->cert);
     if ((sk == NULL) || (sk_SSL_CIPHER_num(sk) <= 0)) {
         SSLerr(SSL_F_SSL_CTX_SET_SSL_VERSION,
                SSL_R_SSL_LIBRARY_HAS_NO_CIPHERS);
@@ -637,17 +645,13 @@ SSL *SSL_new(SSL_CTX *ctx)
     s->references = 1;
 
     /*
-     * Earlier library versions used to copy the pointer to the CERT, not
-     * its contents; only when setting new parameters for the per-SSL
-     * copy, ssl_cert_new would be called (and the direct reference to
-     * the per-SSL_CTX settings would be lost, but those still were
-     * indirectly accessed for various purposes, and for that reason they
-     * used to be known as s->ctx->default_cert). Now we don't look at the
-     * SSL_CTX's CERT after having duplicated it once.
+     * Share the SSL_CTX's CERT rather than duplicating it for every
+     * connection: whichever of the two first changes it takes a private
+     * copy with ssl_cert_unshare(), so later changes to the SSL_CTX still
+     * don't affect this SSL.
      */
-    s->cert = ssl_cert_dup(ctx->cert);
-    if (s->cert == NULL)
-        goto err;
+    CRYPTO_add(&ctx->cert->references, 1, CRYPTO_LOCK_SSL_CERT);
+    s->cert = ctx->cert;
 
     RECORD_LAYER_set_read_ahead(&s->rlayer, ctx->read_ahead);
     s->msg_callback = ctx->msg_callback;
@@ -666,8 +670,15 @@ SSL *SSL_new(SSL_CTX *ctx)
     X509_VERIFY_PARAM_inherit(s->param, ctx->param);
     s->quiet_shutdown = ctx->quiet_shutdown;
     s->max_send_fragment = ctx->max_send_fragment;
-
-    CRYPTO_add(&ctx->references, 1, CRYPTO_LOCK_SSL_CTX);
+    s->split_send_fragment = ctx->split_send_fragment;
+    s->max_pipelines = ctx->max_pipelines;
+    s->write_coalesce_size = ctx->write_coalesce_size;
+    RECORD_LAYER_set_default_read_buffer_len(&s->rlayer,
+                                             ctx->default_read_buf_len);
+    if (s->max_pipelines > 1)
+        RECORD_LAYER_set_read_ahead(&s->rlayer, 1);
+
+    SSL_CTX_up_ref(ctx);
     s->ctx = ctx;
     s->tlsext_debug_cb = 0;
     s->tlsext_debug_arg = NULL;
@@ -678,7 +689,7 @@ SSL *SSL_new(SSL_CTX *ctx)
     s->tlsext_ocsp_exts = NULL;
     s->tlsext_ocsp_resp = NULL;
     s->tlsext_ocsp_resplen = -1;
-    CRYPTO_add(&ctx->references, 1, CRYPTO_LOCK_SSL_CTX);
+    SSL_CTX_up_ref(ctx);
     s->initial_ctx = ctx;
 # ifndef OPENSSL_NO_EC
     if (ctx->tlsext_ecpointformatlist) {
@@ -975,9 +986,42 @@ X509_VERIFY_PARAM *SSL_get0_param(SSL *ssl)
     return ssl->param;
 }
 
+/*
+ * The CERT of |s| for the setters that cannot return an error. If no
+ * private copy can be made, the connection is failed rather than run
+ * without the change, and NULL is returned.
+ */
+static CERT *ssl_cert_for_update(SSL *s)
+{
+    if (ssl_cert_unshare(&s->cert))
+        return s->cert;
+    ossl_statem_set_error(s);
+    return NULL;
+}
+
+/*
+ * The CERT of |ctx| for the setters that cannot return an error. If no
+ * private copy can be made the shared CERT is changed instead, so the
+ * change then also reaches the SSL objects still sharing it.
+ */
+static CERT *ssl_ctx_cert_for_update(SSL_CTX *ctx)
+{
+    ERR_set_mark();
+    if (ssl_cert_unshare(&ctx->cert)) {
+        ERR_pop_to_mark();
+        return ctx->cert;
+    }
+    /* Change the shared CERT after all, without leaving errors behind */
+    ERR_pop_to_mark();
+    return ctx->cert;
+}
+
 void SSL_certs_clear(SSL *s)
 {
-    ssl_cert_clear_certs(s->cert);
+    CERT *c = ssl_cert_for_update(s);
+
+    if (c != NULL)
+        ssl_cert_clear_certs(c);
 }
 
 void SSL_free(SSL *s)
@@ -1031,6 +1075,7 @@ void SSL_free(SSL *s)
     clear_ciphers(s);
 
     ssl_cert_free(s->cert);
+    OPENSSL_free(s->custom_ext_flags);
     /* Free up if allocated */
 
     OPENSSL_free(s->tlsext_hostname);
@@ -1287,6 +1332,18 @@ int SSL_pending(const SSL *s)
     return (s->method->ssl_pending(s));
 }
 
+int SSL_has_pending(const SSL *s)
+{
+    /*
+     * Unlike SSL_pending() this also reports data read ahead from the
+     * network that has not been decoded into records yet. Such data may
+     * still turn out not to hold any application data.
+     */
+    if (SSL_pending(s) > 0)
+        return 1;
+    return RECORD_LAYER_read_pending(&s->rlayer);
+}
+
 X509 *SSL_get_peer_certificate(const SSL *s)
 {
     X509 *r;
@@ -1466,8 +1523,10 @@ static int ssl_io_intern(void *vargs)
     num = args->num;
     if (args->type == 1)
         return args->f.func1(s, buf, num);
-    else
+    else if (args->type == 2)
         return args->f.func2(s, buf, num);
+    else
+        return args->f.func3(s, buf, num);
 }
 
 int SSL_read(SSL *s, void *buf, int num)
@@ -1550,6 +1609,201 @@ int SSL_write(SSL *s, const void *buf, int num)
     }
 }
 
+int SSL_writev(SSL *s, const SSL_IOVEC *iov, int iovcnt)
+{
+    size_t len = 0;
+    int i;
+
+    if (s->handshake_func == 0) {
+        SSLerr(SSL_F_SSL_WRITEV, SSL_R_UNINITIALIZED);
+        return -1;
+    }
+
+    if (s->shutdown & SSL_SENT_SHUTDOWN) {
+        s->rwstate = SSL_NOTHING;
+        SSLerr(SSL_F_SSL_WRITEV, SSL_R_PROTOCOL_IS_SHUTDOWN);
+        return (-1);
+    }
+
+    /* Not for DTLS, where a write must not spread over several datagrams */
+    if (s->method->ssl_writev == NULL) {
+        SSLerr(SSL_F_SSL_WRITEV, SSL_R_UNSUPPORTED_PROTOCOL);
+        return -1;
+    }
+
+    if (iovcnt < 0 || (iovcnt > 0 && iov == NULL)) {
+        SSLerr(SSL_F_SSL_WRITEV, ERR_R_PASSED_NULL_PARAMETER);
+        return -1;
+    }
+    for (i = 0; i < iovcnt; i++) {
+        if (iov[i].len > (size_t)INT_MAX - len
+                || (iov[i].len > 0 && iov[i].buf == NULL)) {
+            SSLerr(SSL_F_SSL_WRITEV, SSL_R_BAD_LENGTH);
+            return -1;
+        }
+        len += iov[i].len;
+    }
+
+    if((s->mode & SSL_MODE_ASYNC) && ASYNC_get_current_job() == NULL) {
+        struct ssl_async_args args;
+
+        args.s = s;
+        args.buf = (void *)iov;
+        args.num = iovcnt;
+        args.type = 3;
+        args.f.func3 = s->method->ssl_writev;
+
+        return ssl_start_async_job(s, &args, ssl_io_intern);
+    } else {
+        return s->method->ssl_writev(s, iov, iovcnt);
+    }
+}
+
+int SSL_flush(SSL *s)
+{
+    int ret;
+
+    if (!SSL_IS_DTLS(s)) {
+        ret = ssl3_write_held(s);
+        if (ret <= 0)
+            return ret;
+    }
+
+    s->rwstate = SSL_WRITING;
+    if (BIO_flush(s->wbio) <= 0)
+        return -1;
+    s->rwstate = SSL_NOTHING;
+    return 1;
+}
+
+#ifdef OPENSSL_SYS_UNIX
+/*
+ * Without kernel TLS, read part of the file and write it with SSL_write().
+ * A retry reads the same data again, into another buffer.
+ */
+static int ssl_sendfile_copy(SSL *s, int fd, off_t offset, size_t size)
+{
+    unsigned char *buf;
+    uint32_t mode;
+    int ret;
+
+    if (size > 4 * SSL3_RT_MAX_PLAIN_LENGTH)
+        size = 4 * SSL3_RT_MAX_PLAIN_LENGTH;
+    if (size == 0)
+        return 0;
+    if ((buf = OPENSSL_malloc(size)) == NULL) {
+        SSLerr(SSL_F_SSL_SENDFILE, ERR_R_MALLOC_FAILURE);
+        return -1;
+    }
+    ret = (int)pread(fd, buf, size, offset);
+    if (ret <= 0) {
+        if (ret < 0)
+            SSLerr(SSL_F_SSL_SENDFILE, ERR_R_SYS_LIB);
+        OPENSSL_free(buf);
+        return ret;
+    }
+
+    mode = s->mode;
+    s->mode |= SSL_MODE_ACCEPT_MOVING_WRITE_BUFFER;
+    ret = SSL_write(s, buf, ret);
+    s->mode = mode;
+    OPENSSL_free(buf);
+    return ret;
+}
+
+static int ssl_sendfile_intern(void *vargs)
+{
+    struct ssl_async_args *args = (struct ssl_async_args *)vargs;
+
+    return ssl_sendfile_copy(args->s, args->fd, args->offset, args->size);
+}
+#endif
+
+/*
+ * Send |size| bytes of the file |fd| from |offset| on. With kernel TLS they
+ * go from the file to the socket without passing through here. Otherwise
+ * part of them are read and written as with SSL_write().
+ */
+ossl_ssize_t SSL_sendfile(SSL *s, int fd, off_t offset, size_t size,
+                          int flags)
+{
+#ifndef OPENSSL_NO_KTLS
+    ossl_ssize_t ret;
+#endif
+
+    if (s->handshake_func == NULL) {
+        SSLerr(SSL_F_SSL_SENDFILE, SSL_R_UNINITIALIZED);
+        return -1;
+    }
+
+    if (s->shutdown & SSL_SENT_SHUTDOWN) {
+        s->rwstate = SSL_NOTHING;
+        SSLerr(SSL_F_SSL_SENDFILE, SSL_R_PROTOCOL_IS_SHUTDOWN);
+        return -1;
+    }
+
+    if (flags != 0) {
+        SSLerr(SSL_F_SSL_SENDFILE, SSL_R_BAD_VALUE);
+        return -1;
+    }
+
+#ifndef OPENSSL_NO_KTLS
+    if (BIO_get_ktls_send(s->wbio) > 0) {
+        /* A write that did not complete must be finished first */
+        if (RECORD_LAYER_write_pending(&s->rlayer)) {
+            SSLerr(SSL_F_SSL_SENDFILE, SSL_R_BAD_WRITE_RETRY);
+            return -1;
+        }
+        if (s->s3->alert_dispatch) {
+            ret = s->method->ssl_dispatch_alert(s);
+            if (ret <= 0)
+                return ret;
+        }
+        ret = SSL_flush(s);
+        if (ret <= 0)
+            return ret;
+
+        s->rwstate = SSL_WRITING;
+        clear_sys_error();
+        ret = ktls_sendfile(SSL_get_wfd(s), fd, offset, size);
+        if (ret < 0) {
+            BIO_clear_retry_flags(s->wbio);
+            if (BIO_sock_should_retry((int)ret)) {
+                BIO_set_retry_write(s->wbio);
+            } else {
+                s->rwstate = SSL_NOTHING;
+                SSLerr(SSL_F_SSL_SENDFILE, ERR_R_SYS_LIB);
+            }
+            return -1;
+        }
+        s->rwstate = SSL_NOTHING;
+        return ret;
+    }
+#endif
+
+#ifdef OPENSSL_SYS_UNIX
+    /*
+     * The read buffer must live as long as the write into it, so with
+     * SSL_MODE_ASYNC the whole copy runs in the job
+     */
+    if ((s->mode & SSL_MODE_ASYNC) && ASYNC_get_current_job() == NULL) {
+        struct ssl_async_args args;
+
+        args.s = s;
+        args.fd = fd;
+        args.offset = offset;
+        args.size = size;
+
+        return ssl_start_async_job(s, &args, ssl_sendfile_intern);
+    } else {
+        return ssl_sendfile_copy(s, fd, offset, size);
+    }
+#else
+    SSLerr(SSL_F_SSL_SENDFILE, ERR_R_DISABLED);
+    return -1;
+#endif
+}
+
 int SSL_shutdown(SSL *s)
 {
     /*
@@ -1626,6 +1880,30 @@ long SSL_ctrl(SSL *s, int cmd, long larg, void *parg)
         if (larg < 512 || larg > SSL3_RT_MAX_PLAIN_LENGTH)
             return 0;
         s->max_send_fragment = larg;
+        if (s->max_send_fragment < s->split_send_fragment)
+            s->split_send_fragment = s->max_send_fragment;
+        return 1;
+    case SSL_CTRL_SET_SPLIT_SEND_FRAGMENT:
+        if ((unsigned int)larg > s->max_send_fragment || larg == 0)
+            return 0;
+        s->split_send_fragment = larg;
+        return 1;
+    case SSL_CTRL_SET_MAX_PIPELINES:
+        if (larg < 1 || larg > SSL_MAX_PIPELINES)
+            return 0;
+        s->max_pipelines = larg;
+        if (larg > 1)
+            RECORD_LAYER_set_read_ahead(&s->rlayer, 1);
+        return 1;
+    case SSL_CTRL_SET_WRITE_COALESCE_SIZE:
+        if (larg < 0 || larg > 16 * SSL3_RT_MAX_PLAIN_LENGTH)
+            return 0;
+        s->write_coalesce_size = larg;
+        return 1;
+    case SSL_CTRL_SET_DEFAULT_READ_BUFFER_LEN:
+        if (larg < 0 || larg > 16 * SSL3_RT_MAX_PLAIN_LENGTH)
+            return 0;
+        RECORD_LAYER_set_default_read_buffer_len(&s->rlayer, larg);
         return 1;
     case SSL_CTRL_GET_RI_SUPPORT:
         if (s->s3)
@@ -1633,8 +1911,12 @@ long SSL_ctrl(SSL *s, int cmd, long larg, void *parg)
         else
             return 0;
     case SSL_CTRL_CERT_FLAGS:
+        if (!ssl_cert_unshare(&s->cert))
+            return 0;
         return (s->cert->cert_flags |= larg);
     case SSL_CTRL_CLEAR_CERT_FLAGS:
+        if (!ssl_cert_unshare(&s->cert))
+            return 0;
         return (s->cert->cert_flags &= ~larg);
 
     case SSL_CTRL_GET_RAW_CIPHERLIST:
@@ -1766,10 +2048,36 @@ long SSL_CTX_ctrl(SSL_CTX *ctx, int cmd, long larg, void *parg)
         if (larg < 512 || larg > SSL3_RT_MAX_PLAIN_LENGTH)
             return 0;
         ctx->max_send_fragment = larg;
+        if (ctx->max_send_fragment < ctx->split_send_fragment)
+            ctx->split_send_fragment = ctx->max_send_fragment;
+        return 1;
+    case SSL_CTRL_SET_SPLIT_SEND_FRAGMENT:
+        if ((unsigned int)larg > ctx->max_send_fragment || larg == 0)
+            return 0;
+        ctx->split_send_fragment = larg;
+        return 1;
+    case SSL_CTRL_SET_MAX_PIPELINES:
+        if (larg < 1 || larg > SSL_MAX_PIPELINES)
+            return 0;
+        ctx->max_pipelines = larg;
+        return 1;
+    case SSL_CTRL_SET_WRITE_COALESCE_SIZE:
+        if (larg < 0 || larg > 16 * SSL3_RT_MAX_PLAIN_LENGTH)
+            return 0;
+        ctx->write_coalesce_size = larg;
+        return 1;
+    case SSL_CTRL_SET_DEFAULT_READ_BUFFER_LEN:
+        if (larg < 0 || larg > 16 * SSL3_RT_MAX_PLAIN_LENGTH)
+            return 0;
+        ctx->default_read_buf_len = larg;
         return 1;
     case SSL_CTRL_CERT_FLAGS:
+        if (!ssl_cert_unshare(&ctx->cert))
+            return 0;
         return (ctx->cert->cert_flags |= larg);
     case SSL_CTRL_CLEAR_CERT_FLAGS:
+        if (!ssl_cert_unshare(&ctx->cert))
+            return 0;
         return (ctx->cert->cert_flags &= ~larg);
     case SSL_CTRL_SET_MIN_PROTO_VERSION:
         return ssl_set_version_bound(ctx->method->version, (int)larg,
@@ -1898,7 +2206,7 @@ int SSL_CTX_set_cipher_list(SSL_CTX *ctx, const char *str)
     STACK_OF(SSL_CIPHER) *sk;
 
     sk = ssl_create_cipher_list(ctx->method, &ctx->cipher_list,
-                                &ctx->cipher_list_by_id, str, ctx->cert);
+                                &ctx->cipher_list_by_id, str, &ctx->cert);
     /*
      * ssl_create_cipher_list may return an empty stack if it was unable to
      * find a cipher matching the given rule string (for example if the rule
@@ -1921,7 +2229,7 @@ int SSL_set_cipher_list(SSL *s, const char *str)
     STACK_OF(SSL_CIPHER) *sk;
 
     sk = ssl_create_cipher_list(s->ctx->method, &s->cipher_list,
-                                &s->cipher_list_by_id, str, s->cert);
+                                &s->cipher_list_by_id, str, &s->cert);
     /* see comment in SSL_CTX_set_cipher_list */
     if (sk == NULL)
         return 0;
@@ -1990,6 +2298,52 @@ int SSL_get_servername_type(const SSL *s)
     return -1;
 }
 
+/*
+ * The ClientHello extensions are only available while the server processes
+ * the ClientHello, e.g. from the servername or certificate callback.
+ */
+static int ssl_in_client_hello(const SSL *s)
+{
+    return s->server && SSL_get_state(s) == TLS_ST_SR_CLNT_HELLO;
+}
+
+int SSL_client_hello_get0_ext(SSL *s, unsigned int type,
+                              const unsigned char **out, size_t *outlen)
+{
+    const RAW_EXTENSION *ext;
+
+    if (!ssl_in_client_hello(s)
+            || (ext = ssl_get_clienthello_ext(s, type)) == NULL)
+        return 0;
+    *out = PACKET_data(&ext->data);
+    *outlen = PACKET_remaining(&ext->data);
+    return 1;
+}
+
+int SSL_client_hello_get1_extensions_present(SSL *s, int **out,
+                                             size_t *outlen)
+{
+    size_t i, num = s->s3->tmp.clienthello_exts_num;
+    int *present;
+
+    if (!ssl_in_client_hello(s))
+        return 0;
+    *out = NULL;
+    *outlen = 0;
+    if (num == 0)
+        return 1;
+    if ((present = OPENSSL_malloc(num * sizeof(*present))) == NULL) {
+        SSLerr(SSL_F_SSL_CLIENT_HELLO_GET1_EXTENSIONS_PRESENT,
+               ERR_R_MALLOC_FAILURE);
+        return 0;
+    }
+    for (i = 0; i < num; i++)
+        present[i] = s->s3->tmp.clienthello_exts[i].type;
+    *out = present;
+    *outlen = num;
+    return 1;
+}
+
 /*
  * SSL_select_next_proto implements the standard protocol selection. It is
  * expected that this function is called from the callback set by
@@ -2253,6 +2607,12 @@ SSL_CTX *SSL_CTX_new(const SSL_METHOD *meth)
     ret = OPENSSL_zalloc(sizeof(*ret));
     if (ret == NULL)
         goto err;
+    ret->lock = CRYPTO_THREAD_lock_new();
+    if (ret->lock == NULL) {
+        OPENSSL_free(ret);
+        ret = NULL;
+        goto err;
+    }
 
     ret->method = meth;
     ret->min_proto_version = 0;
@@ -2276,7 +2636,7 @@ SSL_CTX *SSL_CTX_new(const SSL_METHOD *meth)
 
     if (!ssl_create_cipher_list(ret->method,
                            &ret->cipher_list, &ret->cipher_list_by_id,
-                           SSL_DEFAULT_CIPHER_LIST, ret->cert)
+                           SSL_DEFAULT_CIPHER_LIST, &ret->cert)
        || sk_SSL_CIPHER_num(ret->cipher_list) <= 0) {
         SSLerr(SSL_F_SSL_CTX_NEW, SSL_R_LIBRARY_HAS_NO_CIPHERS);
         goto err2;
@@ -2305,11 +2665,13 @@ SSL_CTX *SSL_CTX_new(const SSL_METHOD *meth)
         ret->comp_methods = SSL_COMP_get_compression_methods();
 
     ret->max_send_fragment = SSL3_RT_MAX_PLAIN_LENGTH;
+    ret->split_send_fragment = SSL3_RT_MAX_PLAIN_LENGTH;
+    ret->max_pipelines = 1;
 
     /* Setup RFC4507 ticket keys */
-    if ((RAND_bytes(ret->tlsext_tick_key_name, 16) <= 0)
-        || (RAND_bytes(ret->tlsext_tick_hmac_key, 16) <= 0)
-        || (RAND_bytes(ret->tlsext_tick_aes_key, 16) <= 0))
+    if ((ret->tlsext_tick_ring = tls1_ticket_ring_new()) == NULL)
+        goto err;
+    if (!tls1_ticket_ring_push(ret, NULL, 1))
         ret->options |= SSL_OP_NO_TICKET;
 
 #ifndef OPENSSL_NO_SRP
@@ -2355,7 +2717,7 @@ void SSL_CTX_free(SSL_CTX *a)
     if (a == NULL)
         return;
 
-    i = CRYPTO_add(&a->references, -1, CRYPTO_LOCK_SSL_CTX);
+    CRYPTO_atomic_add(&a->references, -1, &i, a->lock);
 #ifdef REF_PRINT
     REF_PRINT("SSL_CTX", a);
 #endif
@@ -2391,6 +2753,8 @@ void SSL_CTX_free(SSL_CTX *a)
     ssl_cert_free(a->cert);
     sk_X509_NAME_pop_free(a->client_CA, X509_NAME_free);
     sk_X509_pop_free(a->extra_certs, X509_free);
+    tls1_ocsp_staples_free(a->ocsp_staples);
+    tls1_ticket_ring_free(a->tlsext_tick_ring);
     a->comp_methods = NULL;
 #ifndef OPENSSL_NO_SRTP
     sk_SRTP_PROTECTION_PROFILE_free(a->srtp_profiles);
@@ -2409,9 +2773,17 @@ void SSL_CTX_free(SSL_CTX *a)
 #endif
     OPENSSL_free(a->alpn_client_proto_list);
 
+    CRYPTO_THREAD_lock_free(a->lock);
     OPENSSL_free(a);
 }
 
+int SSL_CTX_up_ref(SSL_CTX *ctx)
+{
+    int i;
+
+    return CRYPTO_atomic_add(&ctx->references, 1, &i, ctx->lock);
+}
+
 void SSL_CTX_set_default_passwd_cb(SSL_CTX *ctx, pem_password_cb *cb)
 {
     ctx->default_passwd_callback = cb;
@@ -2455,12 +2827,15 @@ void SSL_CTX_set_verify_depth(SSL_CTX *ctx, int depth)
 void SSL_CTX_set_cert_cb(SSL_CTX *c, int (*cb) (SSL *ssl, void *arg),
                          void *arg)
 {
-    ssl_cert_set_cert_cb(c->cert, cb, arg);
+    ssl_cert_set_cert_cb(ssl_ctx_cert_for_update(c), cb, arg);
 }
 
 void SSL_set_cert_cb(SSL *s, int (*cb) (SSL *ssl, void *arg), void *arg)
 {
-    ssl_cert_set_cert_cb(s->cert, cb, arg);
+    CERT *c = ssl_cert_for_update(s);
+
+    if (c != NULL)
+        ssl_cert_set_cert_cb(c, cb, arg);
 }
 
 void ssl_set_masks(SSL *s, const SSL_CIPHER *cipher)
@@ -2766,7 +3141,7 @@ void ssl_update_cache(SSL *s, int mode)
         && ((i & SSL_SESS_CACHE_NO_INTERNAL_STORE)
             || SSL_CTX_add_session(s->session_ctx, s->session))
         && (s->session_ctx->new_session_cb != NULL)) {
-        CRYPTO_add(&s->session->references, 1, CRYPTO_LOCK_SSL_SESSION);
+        SSL_SESSION_up_ref(s->session);
         if (!s->session_ctx->new_session_cb(s, s->session))
             SSL_SESSION_free(s->session);
     }
@@ -3281,17 +3656,17 @@ SSL_CTX *SSL_get_SSL_CTX(const SSL *ssl)
 
 SSL_CTX *SSL_set_SSL_CTX(SSL *ssl, SSL_CTX *ctx)
 {
-    CERT *new_cert;
     if (ssl->ctx == ctx)
         return ssl->ctx;
     if (ctx == NULL)
         ctx = ssl->initial_ctx;
-    new_cert = ssl_cert_dup(ctx->cert);
-    if (new_cert == NULL) {
-        return NULL;
-    }
+    CRYPTO_add(&ctx->cert->references, 1, CRYPTO_LOCK_SSL_CERT);
     ssl_cert_free(ssl->cert);
-    ssl->cert = new_cert;
+    ssl->cert = ctx->cert;
+    /* Nothing has been seen yet of the custom extensions of |ctx| */
+    if (ssl->custom_ext_flags != NULL)
+        memset(ssl->custom_ext_flags, 0,
+               sizeof(*ssl->custom_ext_flags) * ssl->custom_ext_flags_num);
 
     /*
      * Program invariant: |sid_ctx| has fixed size (SSL_MAX_SID_CTX_LENGTH),
@@ -3312,7 +3687,7 @@ SSL_CTX *SSL_set_SSL_CTX(SSL *ssl, SSL_CTX *ctx)
         memcpy(&ssl->sid_ctx, &ctx->sid_ctx, sizeof(ssl->sid_ctx));
     }
 
-    CRYPTO_add(&ctx->references, 1, CRYPTO_LOCK_SSL_CTX);
+    SSL_CTX_up_ref(ctx);
     SSL_CTX_free(ssl->ctx); /* decrement reference count */
     ssl->ctx = ctx;
 
@@ -3492,6 +3867,8 @@ int SSL_CTX_use_psk_identity_hint(SSL_CTX *ctx, const char *identity_hint)
                SSL_R_DATA_LENGTH_TOO_LONG);
         return 0;
     }
+    if (!ssl_cert_unshare(&ctx->cert))
+        return 0;
     OPENSSL_free(ctx->cert->psk_identity_hint);
     if (identity_hint != NULL) {
         ctx->cert->psk_identity_hint = OPENSSL_strdup(identity_hint);
@@ -3511,6 +3888,8 @@ int SSL_use_psk_identity_hint(SSL *s, const char *identity_hint)
         SSLerr(SSL_F_SSL_USE_PSK_IDENTITY_HINT, SSL_R_DATA_LENGTH_TOO_LONG);
         return 0;
     }
+    if (!ssl_cert_unshare(&s->cert))
+        return 0;
     OPENSSL_free(s->cert->psk_identity_hint);
     if (identity_hint != NULL) {
         s->cert->psk_identity_hint = OPENSSL_strdup(identity_hint);
@@ -3687,7 +4066,10 @@ void SSL_set_debug(SSL *s, int debug)
 
 void SSL_set_security_level(SSL *s, int level)
 {
-    s->cert->sec_level = level;
+    CERT *c = ssl_cert_for_update(s);
+
+    if (c != NULL)
+        c->sec_level = level;
 }
 
 int SSL_get_security_level(const SSL *s)
@@ -3700,7 +4082,10 @@ void SSL_set_security_callback(SSL *s,
                                           int bits, int nid, void *other,
                                           void *ex))
 {
-    s->cert->sec_cb = cb;
+    CERT *c = ssl_cert_for_update(s);
+
+    if (c != NULL)
+        c->sec_cb = cb;
 }
 
 int (*SSL_get_security_callback(const SSL *s)) (SSL *s, SSL_CTX *ctx, int op,
@@ -3711,7 +4096,10 @@ int (*SSL_get_security_callback(const SSL *s)) (SSL *s, SSL_CTX *ctx, int op,
 
 void SSL_set0_security_ex_data(SSL *s, void *ex)
 {
-    s->cert->sec_ex = ex;
+    CERT *c = ssl_cert_for_update(s);
+
+    if (c != NULL)
+        c->sec_ex = ex;
 }
 
 void *SSL_get0_security_ex_data(const SSL *s)
@@ -3721,7 +4109,7 @@ void *SSL_get0_security_ex_data(const SSL *s)
 
 void SSL_CTX_set_security_level(SSL_CTX *ctx, int level)
 {
-    ctx->cert->sec_level = level;
+    ssl_ctx_cert_for_update(ctx)->sec_level = level;
 }
 
 int SSL_CTX_get_security_level(const SSL_CTX *ctx)
@@ -3734,7 +4122,7 @@ void SSL_CTX_set_security_callback(SSL_CTX *ctx,
                                               int bits, int nid, void *other,
                                               void *ex))
 {
-    ctx->cert->sec_cb = cb;
+    ssl_ctx_cert_for_update(ctx)->sec_cb = cb;
 }
 
 int (*SSL_CTX_get_security_callback(const SSL_CTX *ctx)) (SSL *s,
@@ -3748,7 +4136,7 @@ int (*SSL_CTX_get_security_callback(const SSL_CTX *ctx)) (SSL *s,
 
 void SSL_CTX_set0_security_ex_data(SSL_CTX *ctx, void *ex)
 {
-    ctx->cert->sec_ex = ex;
+    ssl_ctx_cert_for_update(ctx)->sec_ex = ex;
 }
 
 void *SSL_CTX_get0_security_ex_data(const SSL_CTX *ctx)
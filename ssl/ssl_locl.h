@@ -546,6 +546,8 @@ struct ssl_method_st {
     int (*ssl_read) (SSL *s, void *buf, int len);
     int (*ssl_peek) (SSL *s, void *buf, int len);
     int (*ssl_write) (SSL *s, const void *buf, int len);
+    /* NULL if SSL_writev() is not supported */
+    int (*ssl_writev) (SSL *s, const SSL_IOVEC *iov, int iovcnt);
     int (*ssl_shutdown) (SSL *s);
     int (*ssl_renegotiate) (SSL *s);
     int (*ssl_renegotiate_check) (SSL *s);
@@ -630,6 +632,7 @@ struct ssl_session_st {
      */
     long verify_result;         /* only for servers */
     int references;
+    CRYPTO_RWLOCK *lock;
     long timeout;
     long time;
     unsigned int compress_meth; /* Need to lookup the method */
@@ -693,6 +696,11 @@ struct ssl_comp_st {
 
 DEFINE_LHASH_OF(SSL_SESSION);
 
+typedef struct ssl_ocsp_staple_st SSL_OCSP_STAPLE;
+DEFINE_LHASH_OF(SSL_OCSP_STAPLE);
+
+typedef struct ssl_ticket_ring_st SSL_TICKET_RING;
+
 
 struct ssl_ctx_st {
     const SSL_METHOD *method;
@@ -752,6 +760,7 @@ struct ssl_ctx_st {
     } stats;
 
     int references;
+    CRYPTO_RWLOCK *lock;
 
     /* if defined, these override the X509_verify_cert() calls */
     int (*app_verify_callback) (X509_STORE_CTX *, void *);
@@ -832,6 +841,15 @@ struct ssl_ctx_st {
      */
     unsigned int max_send_fragment;
 
+    /* Up to how much data to split a write over several pipelines */
+    unsigned int split_send_fragment;
+    /* Maximum number of records to encrypt or decrypt in one go */
+    unsigned int max_pipelines;
+    /* Hold application data records back until this much is to be sent */
+    unsigned int write_coalesce_size;
+    /* Size of the read buffer if larger than one record, or 0 */
+    size_t default_read_buf_len;
+
 #  ifndef OPENSSL_NO_ENGINE
     /*
      * Engine to pass requests for client certs to
@@ -842,10 +860,8 @@ struct ssl_ctx_st {
     /* TLS extensions servername callback */
     int (*tlsext_servername_callback) (SSL *, int *, void *);
     void *tlsext_servername_arg;
-    /* RFC 4507 session ticket keys */
-    unsigned char tlsext_tick_key_name[16];
-    unsigned char tlsext_tick_hmac_key[16];
-    unsigned char tlsext_tick_aes_key[16];
+    /* RFC 4507 session ticket keys, used if there is no callback */
+    SSL_TICKET_RING *tlsext_tick_ring;
     /* Callback to support customisation of ticket key setting */
     int (*tlsext_ticket_key_cb) (SSL *ssl,
                                  unsigned char *name, unsigned char *iv,
@@ -856,6 +872,10 @@ struct ssl_ctx_st {
     /* Callback for status request */
     int (*tlsext_status_cb) (SSL *ssl, void *arg);
     void *tlsext_status_arg;
+    /* Cached OCSP responses stapled when there is no status callback */
+    LHASH_OF(SSL_OCSP_STAPLE) *ocsp_staples;
+    void (*ocsp_staple_refresh_cb) (SSL_CTX *ctx, X509 *x, void *arg);
+    void *ocsp_staple_refresh_arg;
 
 #  ifndef OPENSSL_NO_PSK
     unsigned int (*psk_client_callback) (SSL *ssl, const char *hint,
@@ -1030,6 +1050,12 @@ struct ssl_st {
     /* client cert? */
     /* This is used to hold the server certificate used */
     struct cert_st /* CERT */ *cert;
+    /*
+     * Per-connection flags of the custom extensions in |cert|, one per
+     * method, kept here so that the CERT can stay shared
+     */
+    uint32_t *custom_ext_flags;
+    size_t custom_ext_flags_num;
     /*
      * the session_id_context is used to ensure sessions are only reused in
      * the appropriate context
@@ -1082,6 +1108,9 @@ struct ssl_st {
     /* what was passed, used for SSLv3/TLS rollback check */
     int client_version;
     unsigned int max_send_fragment;
+    unsigned int split_send_fragment;
+    unsigned int max_pipelines;
+    unsigned int write_coalesce_size;
 
     /* TLS extension debug callback */
     void (*tlsext_debug_cb) (SSL *s, int client_server, int type,
@@ -1188,6 +1217,12 @@ struct ssl_st {
 };
 
 
+/* One extension of a received ClientHello, pointing into the message */
+typedef struct raw_extension_st {
+    unsigned int type;
+    PACKET data;
+} RAW_EXTENSION;
+
 typedef struct ssl3_state_st {
     long flags;
     int read_mac_secret_size;
@@ -1261,6 +1296,13 @@ typedef struct ssl3_state_st {
         /* Raw values of the cipher list from a client */
         unsigned char *ciphers_raw;
         size_t ciphers_rawlen;
+        /*
+         * The extensions of the ClientHello being processed, in the order
+         * sent. Only valid while the ClientHello is in init_buf.
+         */
+        RAW_EXTENSION *clienthello_exts;
+        size_t clienthello_exts_num;
+        size_t clienthello_exts_max;
         /* Temporary storage for premaster secret */
         unsigned char *pms;
         size_t pmslen;
@@ -1277,6 +1319,12 @@ typedef struct ssl3_state_st {
         unsigned char *peer_sigalgs;
         /* Size of above array */
         size_t peer_sigalgslen;
+        /*
+         * Signature algorithms shared by client and server: cached because
+         * these are used most often.
+         */
+        TLS_SIGALGS *shared_sigalgs;
+        size_t shared_sigalgslen;
         /* Digest peer uses for signing */
         const EVP_MD *peer_md;
         /* Array of digests used for signing */
@@ -1482,11 +1530,6 @@ typedef struct cert_pkey_st {
 
 typedef struct {
     unsigned short ext_type;
-    /*
-     * Per-connection flags relating to this extension type: not used if
-     * part of an SSL_CTX structure.
-     */
-    uint32_t ext_flags;
     custom_ext_add_cb add_cb;
     custom_ext_free_cb free_cb;
     void *add_arg;
@@ -1494,7 +1537,7 @@ typedef struct {
     void *parse_arg;
 } custom_ext_method;
 
-/* ext_flags values */
+/* Flags of custom extensions, see SSL's custom_ext_flags */
 
 /*
  * Indicates an extension has been received. Used to check for unsolicited or
@@ -1553,12 +1596,6 @@ typedef struct cert_st {
     unsigned char *client_sigalgs;
     /* Size of above array */
     size_t client_sigalgslen;
-    /*
-     * Signature algorithms shared by client and server: cached because these
-     * are used most often.
-     */
-    TLS_SIGALGS *shared_sigalgs;
-    size_t shared_sigalgslen;
     /*
      * Certificate setup callback: if set is called whenever a certificate
      * may be required (client or server). the callback can then examine any
@@ -1587,7 +1624,11 @@ typedef struct cert_st {
     /* If not NULL psk identity hint to use for servers */
     char *psk_identity_hint;
 #endif
-    int references;             /* >1 only if SSL_copy_session_id is used */
+    /*
+     * An SSL shares its SSL_CTX's CERT until either of them changes it, see
+     * ssl_cert_unshare()
+     */
+    int references;
 } CERT;
 
 /* Structure containing decoded values of signature algorithms extension */
@@ -1639,8 +1680,8 @@ struct tls_sigalgs_st {
  * of a mess of functions, but hell, think of it as an opaque structure :-)
  */
 typedef struct ssl3_enc_method {
-    int (*enc) (SSL *, int);
-    int (*mac) (SSL *, unsigned char *, int);
+    int (*enc) (SSL *, SSL3_RECORD *, unsigned int, int);
+    int (*mac) (SSL *, SSL3_RECORD *, unsigned char *, int);
     int (*setup_key_block) (SSL *);
     int (*generate_master_secret) (SSL *, unsigned char *, unsigned char *,
                                    int);
@@ -1733,6 +1774,7 @@ const SSL_METHOD *func_name(void)  \
                 ssl3_read, \
                 ssl3_peek, \
                 ssl3_write, \
+                ssl3_writev, \
                 ssl3_shutdown, \
                 ssl3_renegotiate, \
                 ssl3_renegotiate_check, \
@@ -1771,6 +1813,7 @@ const SSL_METHOD *func_name(void)  \
                 ssl3_read, \
                 ssl3_peek, \
                 ssl3_write, \
+                ssl3_writev, \
                 ssl3_shutdown, \
                 ssl3_renegotiate, \
                 ssl3_renegotiate_check, \
@@ -1810,6 +1853,7 @@ const SSL_METHOD *func_name(void)  \
                 ssl3_read, \
                 ssl3_peek, \
                 ssl3_write, \
+                NULL, \
                 dtls1_shutdown, \
                 ssl3_renegotiate, \
                 ssl3_renegotiate_check, \
@@ -1848,11 +1892,12 @@ void ssl_clear_cipher_ctx(SSL *s);
 int ssl_clear_bad_session(SSL *s);
 __owur CERT *ssl_cert_new(void);
 __owur CERT *ssl_cert_dup(CERT *cert);
+__owur int ssl_cert_unshare(CERT **pc);
+__owur int ssl_cert_set_key(CERT **pc, CERT_PKEY *cpk);
 void ssl_cert_clear_certs(CERT *c);
 void ssl_cert_free(CERT *c);
 __owur int ssl_get_new_session(SSL *s, int session);
-__owur int ssl_get_prev_session(SSL *s, const PACKET *ext,
-                                const PACKET *session_id);
+__owur int ssl_get_prev_session(SSL *s, const PACKET *session_id);
 __owur SSL_SESSION *ssl_session_dup(SSL_SESSION *src, int ticket);
 __owur int ssl_cipher_id_cmp(const SSL_CIPHER *a, const SSL_CIPHER *b);
 DECLARE_OBJ_BSEARCH_GLOBAL_CMP_FN(SSL_CIPHER, SSL_CIPHER, ssl_cipher_id);
@@ -1861,7 +1906,7 @@ __owur int ssl_cipher_ptr_id_cmp(const SSL_CIPHER *const *ap,
 __owur STACK_OF(SSL_CIPHER) *ssl_create_cipher_list(const SSL_METHOD *meth,
                                              STACK_OF(SSL_CIPHER) **pref,
                                              STACK_OF(SSL_CIPHER) **sorted,
-                                             const char *rule_str, CERT *c);
+                                             const char *rule_str, CERT **pc);
 void ssl_update_cache(SSL *s, int mode);
 __owur int ssl_cipher_get_evp(const SSL_SESSION *s, const EVP_CIPHER **enc,
                        const EVP_MD **md, int *mac_pkey_type,
@@ -1935,6 +1980,7 @@ void ssl3_free(SSL *s);
 __owur int ssl3_read(SSL *s, void *buf, int len);
 __owur int ssl3_peek(SSL *s, void *buf, int len);
 __owur int ssl3_write(SSL *s, const void *buf, int len);
+__owur int ssl3_writev(SSL *s, const SSL_IOVEC *iov, int iovcnt);
 __owur int ssl3_shutdown(SSL *s);
 void ssl3_clear(SSL *s);
 __owur long ssl3_ctrl(SSL *s, int cmd, long larg, void *parg);
@@ -2048,10 +2094,25 @@ __owur unsigned char *ssl_add_clienthello_tlsext(SSL *s, unsigned char *buf,
                                           unsigned char *limit, int *al);
 __owur unsigned char *ssl_add_serverhello_tlsext(SSL *s, unsigned char *buf,
                                           unsigned char *limit, int *al);
+__owur int ssl_collect_clienthello_tlsext(SSL *s, const PACKET *pkt,
+                                          int *al);
+__owur const RAW_EXTENSION *ssl_get_clienthello_ext(const SSL *s,
+                                                    unsigned int type);
 __owur int ssl_parse_clienthello_tlsext(SSL *s, PACKET *pkt);
 void ssl_set_default_md(SSL *s);
 __owur int tls1_set_server_sigalgs(SSL *s);
 __owur int ssl_check_clienthello_tlsext_late(SSL *s);
+__owur int tls1_ocsp_staple_set(SSL *s, X509 *x);
+void tls1_ocsp_staples_free(LHASH_OF(SSL_OCSP_STAPLE) *staples);
+__owur SSL_TICKET_RING *tls1_ticket_ring_new(void);
+void tls1_ticket_ring_free(SSL_TICKET_RING *ring);
+__owur int tls1_ticket_ring_push(SSL_CTX *ctx, const unsigned char *keys,
+                                 int replace);
+__owur int tls1_ticket_ring_set_max(SSL_CTX *ctx, size_t max);
+__owur int tls1_ticket_ring_get(SSL_CTX *ctx, unsigned char *keys);
+__owur int tls1_ticket_ring_init(SSL_CTX *ctx, unsigned char *name,
+                                 unsigned char *iv, EVP_CIPHER_CTX *ectx,
+                                 HMAC_CTX *hctx, int enc);
 __owur int ssl_parse_serverhello_tlsext(SSL *s, PACKET *pkt);
 __owur int ssl_prepare_clienthello_tlsext(SSL *s);
 __owur int ssl_prepare_serverhello_tlsext(SSL *s);
@@ -2063,7 +2124,7 @@ __owur int tls1_process_heartbeat(SSL *s, unsigned char *p, unsigned int length)
 __owur int dtls1_process_heartbeat(SSL *s, unsigned char *p, unsigned int length);
 #  endif
 
-__owur int tls_check_serverhello_tlsext_early(SSL *s, const PACKET *ext,
+__owur int tls_check_serverhello_tlsext_early(SSL *s,
                                               const PACKET *session_id,
                                               SSL_SESSION **ret);
 
@@ -2140,7 +2201,7 @@ __owur int srp_verify_server_param(SSL *s, int *al);
 
 /* t1_ext.c */
 
-void custom_ext_init(custom_ext_methods *meths);
+__owur int custom_ext_init(SSL *s, int server);
 
 __owur int custom_ext_parse(SSL *s, int server,
                      unsigned int ext_type,
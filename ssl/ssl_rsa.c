@@ -64,8 +64,8 @@
 #include <openssl/x509.h>
 #include <openssl/pem.h>
 
-static int ssl_set_cert(CERT *c, X509 *x509);
-static int ssl_set_pkey(CERT *c, EVP_PKEY *pkey);
+static int ssl_set_cert(CERT **pc, X509 *x509);
+static int ssl_set_pkey(CERT **pc, EVP_PKEY *pkey);
 int SSL_use_certificate(SSL *ssl, X509 *x)
 {
     int rv;
@@ -79,7 +79,7 @@ int SSL_use_certificate(SSL *ssl, X509 *x)
         return 0;
     }
 
-    return (ssl_set_cert(ssl->cert, x));
+    return (ssl_set_cert(&ssl->cert, x));
 }
 
 #ifndef OPENSSL_NO_STDIO
@@ -162,20 +162,26 @@ int SSL_use_RSAPrivateKey(SSL *ssl, RSA *rsa)
         return 0;
     }
 
-    ret = ssl_set_pkey(ssl->cert, pkey);
+    ret = ssl_set_pkey(&ssl->cert, pkey);
     EVP_PKEY_free(pkey);
     return (ret);
 }
 #endif
 
-static int ssl_set_pkey(CERT *c, EVP_PKEY *pkey)
+static int ssl_set_pkey(CERT **pc, EVP_PKEY *pkey)
 {
+    CERT *c;
     int i;
     i = ssl_cert_type(NULL, pkey);
     if (i < 0) {
         SSLerr(SSL_F_SSL_SET_PKEY, SSL_R_UNKNOWN_CERTIFICATE_TYPE);
         return (0);
     }
+    if (!ssl_cert_unshare(pc)) {
+        SSLerr(SSL_F_SSL_SET_PKEY, ERR_R_MALLOC_FAILURE);
+        return 0;
+    }
+    c = *pc;
 
     if (c->pkeys[i].x509 != NULL) {
         EVP_PKEY *pktmp;
@@ -283,7 +289,7 @@ int SSL_use_PrivateKey(SSL *ssl, EVP_PKEY *pkey)
         SSLerr(SSL_F_SSL_USE_PRIVATEKEY, ERR_R_PASSED_NULL_PARAMETER);
         return (0);
     }
-    ret = ssl_set_pkey(ssl->cert, pkey);
+    ret = ssl_set_pkey(&ssl->cert, pkey);
     return (ret);
 }
 
@@ -359,11 +365,12 @@ int SSL_CTX_use_certificate(SSL_CTX *ctx, X509 *x)
         SSLerr(SSL_F_SSL_CTX_USE_CERTIFICATE, rv);
         return 0;
     }
-    return (ssl_set_cert(ctx->cert, x));
+    return (ssl_set_cert(&ctx->cert, x));
 }
 
-static int ssl_set_cert(CERT *c, X509 *x)
+static int ssl_set_cert(CERT **pc, X509 *x)
 {
+    CERT *c;
     EVP_PKEY *pkey;
     int i;
 
@@ -378,6 +385,11 @@ static int ssl_set_cert(CERT *c, X509 *x)
         SSLerr(SSL_F_SSL_SET_CERT, SSL_R_UNKNOWN_CERTIFICATE_TYPE);
         return 0;
     }
+    if (!ssl_cert_unshare(pc)) {
+        SSLerr(SSL_F_SSL_SET_CERT, ERR_R_MALLOC_FAILURE);
+        return 0;
+    }
+    c = *pc;
 
     if (c->pkeys[i].privatekey != NULL) {
         /*
@@ -499,7 +511,7 @@ int SSL_CTX_use_RSAPrivateKey(SSL_CTX *ctx, RSA *rsa)
         return 0;
     }
 
-    ret = ssl_set_pkey(ctx->cert, pkey);
+    ret = ssl_set_pkey(&ctx->cert, pkey);
     EVP_PKEY_free(pkey);
     return (ret);
 }
@@ -570,7 +582,7 @@ int SSL_CTX_use_PrivateKey(SSL_CTX *ctx, EVP_PKEY *pkey)
         SSLerr(SSL_F_SSL_CTX_USE_PRIVATEKEY, ERR_R_PASSED_NULL_PARAMETER);
         return (0);
     }
-    return (ssl_set_pkey(ctx->cert, pkey));
+    return (ssl_set_pkey(&ctx->cert, pkey));
 }
 
 #ifndef OPENSSL_NO_STDIO
@@ -898,6 +910,10 @@ int SSL_CTX_use_serverinfo(SSL_CTX *ctx, const unsigned char *serverinfo,
         SSLerr(SSL_F_SSL_CTX_USE_SERVERINFO, ERR_R_INTERNAL_ERROR);
         return 0;
     }
+    if (!ssl_cert_unshare(&ctx->cert)) {
+        SSLerr(SSL_F_SSL_CTX_USE_SERVERINFO, ERR_R_MALLOC_FAILURE);
+        return 0;
+    }
     new_serverinfo = OPENSSL_realloc(ctx->cert->key->serverinfo,
                                      serverinfo_length);
     if (new_serverinfo == NULL) {
@@ -158,15 +158,15 @@ SSL_SESSION *SSL_get1_session(SSL *ssl)
 {
     SSL_SESSION *sess;
     /*
-     * Need to lock this all up rather than just use CRYPTO_add so that
-     * somebody doesn't free ssl->session between when we check it's non-null
-     * and when we up the reference count.
+     * Need to lock this all up rather than just up the reference count so
+     * that somebody doesn't free ssl->session between when we check it's
+     * non-null and when we up the reference count.
      */
-    CRYPTO_w_lock(CRYPTO_LOCK_SSL_SESSION);
+    CRYPTO_r_lock(CRYPTO_LOCK_SSL_SESSION);
     sess = ssl->session;
     if (sess)
-        sess->references++;
-    CRYPTO_w_unlock(CRYPTO_LOCK_SSL_SESSION);
+        SSL_SESSION_up_ref(sess);
+    CRYPTO_r_unlock(CRYPTO_LOCK_SSL_SESSION);
     return (sess);
 }
 
@@ -194,6 +194,12 @@ SSL_SESSION *SSL_SESSION_new(void)
     ss->references = 1;
     ss->timeout = 60 * 5 + 4;   /* 5 minute timeout by default */
     ss->time = (unsigned long)time(NULL);
+    ss->lock = CRYPTO_THREAD_lock_new();
+    if (ss->lock == NULL) {
+        SSLerr(SSL_F_SSL_SESSION_NEW, ERR_R_MALLOC_FAILURE);
+        OPENSSL_free(ss);
+        return (NULL);
+    }
     CRYPTO_new_ex_data(CRYPTO_EX_INDEX_SSL_SESSION, ss, &ss->ex_data);
     return (ss);
 }
@@ -238,6 +244,13 @@ SSL_SESSION *ssl_session_dup(SSL_SESSION *src, int ticket)
 
     dest->references = 1;
 
+    dest->lock = CRYPTO_THREAD_lock_new();
+    if (dest->lock == NULL) {
+        OPENSSL_free(dest);
+        dest = NULL;
+        goto err;
+    }
+
     if (src->peer != NULL)
         X509_up_ref(src->peer);
 
@@ -506,9 +519,9 @@ int ssl_get_new_session(SSL *s, int session)
 
 /*-
  * ssl_get_prev attempts to find an SSL_SESSION to be used to resume this
- * connection. It is only called by servers.
+ * connection. It is only called by servers, once the ClientHello extensions
+ * have been collected with ssl_collect_clienthello_tlsext().
  *
- *   ext: ClientHello extensions (including length prefix)
  *   session_id: ClientHello session ID.
  *
  * Returns:
@@ -521,7 +534,7 @@ int ssl_get_new_session(SSL *s, int session)
  *   - Both for new and resumed sessions, s->tlsext_ticket_expected is set to 1
  *     if the server should issue a new session ticket (to 0 otherwise).
  */
-int ssl_get_prev_session(SSL *s, const PACKET *ext, const PACKET *session_id)
+int ssl_get_prev_session(SSL *s, const PACKET *session_id)
 {
     /* This is used only by servers. */
 
@@ -534,7 +547,7 @@ int ssl_get_prev_session(SSL *s, const PACKET *ext, const PACKET *session_id)
         try_session_cache = 0;
 
     /* sets s->tlsext_ticket_expected and extended master secret flag */
-    r = tls_check_serverhello_tlsext_early(s, ext, session_id, &ret);
+    r = tls_check_serverhello_tlsext_early(s, session_id, &ret);
     switch (r) {
     case -1:                   /* Error during processing */
         fatal = 1;
@@ -567,7 +580,7 @@ int ssl_get_prev_session(SSL *s, const PACKET *ext, const PACKET *session_id)
         ret = lh_SSL_SESSION_retrieve(s->session_ctx->sessions, &data);
         if (ret != NULL) {
             /* don't allow other threads to steal it: */
-            CRYPTO_add(&ret->references, 1, CRYPTO_LOCK_SSL_SESSION);
+            SSL_SESSION_up_ref(ret);
         }
         CRYPTO_r_unlock(CRYPTO_LOCK_SSL_CTX);
         if (ret == NULL)
@@ -596,7 +609,7 @@ int ssl_get_prev_session(SSL *s, const PACKET *ext, const PACKET *session_id)
              * thread-safe).
              */
             if (copy)
-                CRYPTO_add(&ret->references, 1, CRYPTO_LOCK_SSL_SESSION);
+                SSL_SESSION_up_ref(ret);
 
             /*
              * Add the externally cached session to the internal cache as
@@ -719,7 +732,7 @@ int SSL_CTX_add_session(SSL_CTX *ctx, SSL_SESSION *c)
      * it has two ways of access: each session is in a doubly linked list and
      * an lhash
      */
-    CRYPTO_add(&c->references, 1, CRYPTO_LOCK_SSL_SESSION);
+    SSL_SESSION_up_ref(c);
     /*
      * if session c is in already in cache, we take back the increment later
      */
@@ -818,7 +831,7 @@ void SSL_SESSION_free(SSL_SESSION *ss)
     if (ss == NULL)
         return;
 
-    i = CRYPTO_add(&ss->references, -1, CRYPTO_LOCK_SSL_SESSION);
+    CRYPTO_atomic_add(&ss->references, -1, &i, ss->lock);
 #ifdef REF_PRINT
     REF_PRINT("SSL_SESSION", ss);
 #endif
@@ -853,9 +866,17 @@ void SSL_SESSION_free(SSL_SESSION *ss)
 #ifndef OPENSSL_NO_SRP
     OPENSSL_free(ss->srp_username);
 #endif
+    CRYPTO_THREAD_lock_free(ss->lock);
     OPENSSL_clear_free(ss, sizeof(*ss));
 }
 
+int SSL_SESSION_up_ref(SSL_SESSION *ss)
+{
+    int i;
+
+    return CRYPTO_atomic_add(&ss->references, 1, &i, ss->lock);
+}
+
 int SSL_set_session(SSL *s, SSL_SESSION *session)
 {
     int ret = 0;
@@ -876,7 +897,7 @@ int SSL_set_session(SSL *s, SSL_SESSION *session)
         }
 
         /* CRYPTO_w_lock(CRYPTO_LOCK_SSL); */
-        CRYPTO_add(&session->references, 1, CRYPTO_LOCK_SSL_SESSION);
+        SSL_SESSION_up_ref(session);
         SSL_SESSION_free(s->session);
         s->session = session;
         s->verify_result = s->session->verify_result;
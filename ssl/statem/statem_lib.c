@@ -518,8 +518,16 @@ int tls_get_message_header(SSL *s, int *mt)
             SSLerr(SSL_F_TLS_GET_MESSAGE_HEADER, SSL_R_EXCESSIVE_MESSAGE_SIZE);
             goto f_err;
         }
-        if (l && !BUF_MEM_grow_clean(s->init_buf,
-                                    (int)l + SSL3_HM_HEADER_LENGTH)) {
+        /*
+         * Only ever grow the buffer. It starts out as large as a record, so
+         * most messages fit, and shrinking it would clear the rest of it
+         * again for every message. Whatever an earlier, longer message left
+         * past the end of this one stays there until the buffer is freed,
+         * and so cleared, at the end of the handshake.
+         */
+        if (l + SSL3_HM_HEADER_LENGTH > s->init_buf->length
+                && !BUF_MEM_grow_clean(s->init_buf,
+                                       (int)l + SSL3_HM_HEADER_LENGTH)) {
             SSLerr(SSL_F_TLS_GET_MESSAGE_HEADER, ERR_R_BUF_LIB);
             goto err;
         }
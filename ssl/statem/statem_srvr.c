@@ -1155,6 +1155,12 @@ MSG_PROCESS_RETURN tls_process_client_hello(SSL *s, PACKET *pkt)
         extensions = *pkt;
     }
 
+    /* Index the extensions once for everything below that looks at them */
+    if (!ssl_collect_clienthello_tlsext(s, &extensions, &al)) {
+        SSLerr(SSL_F_TLS_PROCESS_CLIENT_HELLO, SSL_R_PARSE_TLSEXT);
+        goto f_err;
+    }
+
     s->hit = 0;
 
     /*
@@ -1179,7 +1185,7 @@ MSG_PROCESS_RETURN tls_process_client_hello(SSL *s, PACKET *pkt)
         if (!ssl_get_new_session(s, 1))
             goto err;
     } else {
-        i = ssl_get_prev_session(s, &extensions, &session_id);
+        i = ssl_get_prev_session(s, &session_id);
         /*
          * Only resume if the session's version matches the negotiated
          * version.
@@ -3015,15 +3021,8 @@ int tls_construct_new_session_ticket(SSL *s)
         if (tctx->tlsext_ticket_key_cb(s, key_name, iv, ctx, hctx, 1) < 0)
             goto err;
     } else {
-        if (RAND_bytes(iv, 16) <= 0)
-            goto err;
-        if (!EVP_EncryptInit_ex(ctx, EVP_aes_128_cbc(), NULL,
-                                tctx->tlsext_tick_aes_key, iv))
-            goto err;
-        if (!HMAC_Init_ex(hctx, tctx->tlsext_tick_hmac_key, 16,
-                          EVP_sha256(), NULL))
+        if (tls1_ticket_ring_init(tctx, key_name, iv, ctx, hctx, 1) <= 0)
             goto err;
-        memcpy(key_name, tctx->tlsext_tick_key_name, 16);
     }
 
     /*
@@ -143,6 +143,7 @@
 #include <openssl/evp.h>
 #include <openssl/kdf.h>
 #include <openssl/rand.h>
+#include "internal/ktls.h"
 
 /* seed1 through seed5 are concatenated */
 static int tls1_PRF(SSL *s,
@@ -204,6 +205,77 @@ static int tls1_generate_key_block(SSL *s, unsigned char *km, int num)
     return ret;
 }
 
+#ifndef OPENSSL_NO_KTLS
+/*
+ * Hand the new |key| and fixed |iv| for sending (|is_tx| != 0) or receiving
+ * to the kernel if SSL_MODE_ENABLE_KTLS is set and it can do the encryption.
+ * Otherwise, or if anything fails, the records are still handled here.
+ */
+static void tls1_ktls_start(SSL *s, const EVP_CIPHER *c,
+                            const unsigned char *key,
+                            const unsigned char *iv, int is_tx)
+{
+    KTLS_CRYPTO_INFO ci;
+    BIO *bio = is_tx ? s->wbio : s->rbio;
+    unsigned char *seq;
+
+    if (!(s->mode & SSL_MODE_ENABLE_KTLS) || SSL_IS_DTLS(s)
+            || s->version != TLS1_2_VERSION
+            || EVP_CIPHER_mode(c) != EVP_CIPH_GCM_MODE
+            || s->compress != NULL || s->expand != NULL || bio == NULL)
+        return;
+
+    if (is_tx) {
+        seq = RECORD_LAYER_get_write_sequence(&s->rlayer);
+    } else {
+        /*
+         * Anything read ahead already is still encrypted with the new keys
+         * and would be lost to the kernel.
+         */
+        if (RECORD_LAYER_read_pending(&s->rlayer))
+            return;
+        seq = RECORD_LAYER_get_read_sequence(&s->rlayer);
+    }
+
+    /* The explicit part of the nonce just counts up from the sequence */
+    memset(&ci, 0, sizeof(ci));
+    switch (EVP_CIPHER_key_length(c)) {
+    case TLS_CIPHER_AES_GCM_128_KEY_SIZE:
+        ci.u.gcm128.info.version = TLS_1_2_VERSION;
+        ci.u.gcm128.info.cipher_type = TLS_CIPHER_AES_GCM_128;
+        memcpy(ci.u.gcm128.key, key, TLS_CIPHER_AES_GCM_128_KEY_SIZE);
+        memcpy(ci.u.gcm128.salt, iv, TLS_CIPHER_AES_GCM_128_SALT_SIZE);
+        memcpy(ci.u.gcm128.iv, seq, TLS_CIPHER_AES_GCM_128_IV_SIZE);
+        memcpy(ci.u.gcm128.rec_seq, seq,
+               TLS_CIPHER_AES_GCM_128_REC_SEQ_SIZE);
+        ci.len = sizeof(ci.u.gcm128);
+        break;
+# ifdef TLS_CIPHER_AES_GCM_256
+    case TLS_CIPHER_AES_GCM_256_KEY_SIZE:
+        ci.u.gcm256.info.version = TLS_1_2_VERSION;
+        ci.u.gcm256.info.cipher_type = TLS_CIPHER_AES_GCM_256;
+        memcpy(ci.u.gcm256.key, key, TLS_CIPHER_AES_GCM_256_KEY_SIZE);
+        memcpy(ci.u.gcm256.salt, iv, TLS_CIPHER_AES_GCM_256_SALT_SIZE);
+        memcpy(ci.u.gcm256.iv, seq, TLS_CIPHER_AES_GCM_256_IV_SIZE);
+        memcpy(ci.u.gcm256.rec_seq, seq,
+               TLS_CIPHER_AES_GCM_256_REC_SEQ_SIZE);
+        ci.len = sizeof(ci.u.gcm256);
+        break;
+# endif
+    default:
+        return;
+    }
+
+    /*
+     * Records already encrypted here must leave before the kernel starts.
+     * As it can't take new keys afterwards, renegotiation is refused.
+     */
+    if ((!is_tx || BIO_flush(bio) > 0) && BIO_set_ktls(bio, &ci, is_tx) > 0)
+        s->s3->flags |= SSL3_FLAGS_NO_RENEGOTIATE_CIPHERS;
+    OPENSSL_cleanse(&ci, sizeof(ci));
+}
+#endif
+
 int tls1_change_cipher_state(SSL *s, int which)
 {
     unsigned char *p, *mac_secret;
@@ -233,6 +305,11 @@ int tls1_change_cipher_state(SSL *s, int which)
 #endif
 
     if (which & SSL3_CC_READ) {
+        /* The kernel has the current read keys and can't change them */
+        if (BIO_get_ktls_recv(s->rbio) > 0) {
+            SSLerr(SSL_F_TLS1_CHANGE_CIPHER_STATE, ERR_R_INTERNAL_ERROR);
+            goto err2;
+        }
         if (s->s3->tmp.new_cipher->algorithm2 & TLS1_STREAM_MAC)
             s->mac_flags |= SSL_MAC_FLAG_READ_MAC_STREAM;
         else
@@ -273,6 +350,11 @@ int tls1_change_cipher_state(SSL *s, int which)
         mac_secret = &(s->s3->read_mac_secret[0]);
         mac_secret_size = &(s->s3->read_mac_secret_size);
     } else {
+        /* The kernel has the current write keys and can't change them */
+        if (BIO_get_ktls_send(s->wbio) > 0) {
+            SSLerr(SSL_F_TLS1_CHANGE_CIPHER_STATE, ERR_R_INTERNAL_ERROR);
+            goto err2;
+        }
         if (s->s3->tmp.new_cipher->algorithm2 & TLS1_STREAM_MAC)
             s->mac_flags |= SSL_MAC_FLAG_WRITE_MAC_STREAM;
         else
@@ -427,6 +509,10 @@ int tls1_change_cipher_state(SSL *s, int which)
     }
 #endif
 
+#ifndef OPENSSL_NO_KTLS
+    tls1_ktls_start(s, c, key, iv, (which & SSL3_CC_WRITE) != 0);
+#endif
+
 #ifdef TLS_DEBUG
     printf("which = %04X\nkey=", which);
     {
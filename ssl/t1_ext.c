@@ -71,15 +71,38 @@ static custom_ext_method *custom_ext_find(custom_ext_methods *exts,
     return NULL;
 }
 
+/*
+ * The per-connection flags of the custom extensions |exts| of |s|, or NULL
+ * if custom_ext_init() has not set them up for |exts|.
+ */
+static uint32_t *custom_ext_flags(SSL *s, const custom_ext_methods *exts)
+{
+    if (s->custom_ext_flags_num < exts->meths_count)
+        return NULL;
+    return s->custom_ext_flags;
+}
+
 /*
  * Initialise custom extensions flags to indicate neither sent nor received.
  */
-void custom_ext_init(custom_ext_methods *exts)
+int custom_ext_init(SSL *s, int server)
 {
-    size_t i;
-    custom_ext_method *meth = exts->meths;
-    for (i = 0; i < exts->meths_count; i++, meth++)
-        meth->ext_flags = 0;
+    custom_ext_methods *exts = server ? &s->cert->srv_ext : &s->cert->cli_ext;
+    uint32_t *flags;
+
+    if (exts->meths_count == 0)
+        return 1;
+    if (s->custom_ext_flags_num < exts->meths_count) {
+        flags = OPENSSL_realloc(s->custom_ext_flags,
+                                sizeof(*flags) * exts->meths_count);
+        if (flags == NULL)
+            return 0;
+        s->custom_ext_flags = flags;
+        s->custom_ext_flags_num = exts->meths_count;
+    }
+    memset(s->custom_ext_flags, 0,
+           sizeof(*s->custom_ext_flags) * s->custom_ext_flags_num);
+    return 1;
 }
 
 /* Pass received custom extension data to the application for parsing. */
@@ -89,26 +112,33 @@ int custom_ext_parse(SSL *s, int server,
 {
     custom_ext_methods *exts = server ? &s->cert->srv_ext : &s->cert->cli_ext;
     custom_ext_method *meth;
+    uint32_t *flags;
+
     meth = custom_ext_find(exts, ext_type);
     /* If not found return success */
     if (!meth)
         return 1;
+    if ((flags = custom_ext_flags(s, exts)) == NULL) {
+        *al = TLS1_AD_INTERNAL_ERROR;
+        return 0;
+    }
+    flags += meth - exts->meths;
     if (!server) {
         /*
          * If it's ServerHello we can't have any extensions not sent in
          * ClientHello.
          */
-        if (!(meth->ext_flags & SSL_EXT_FLAG_SENT)) {
+        if (!(*flags & SSL_EXT_FLAG_SENT)) {
             *al = TLS1_AD_UNSUPPORTED_EXTENSION;
             return 0;
         }
     }
     /* If already present it's a duplicate */
-    if (meth->ext_flags & SSL_EXT_FLAG_RECEIVED) {
+    if (*flags & SSL_EXT_FLAG_RECEIVED) {
         *al = TLS1_AD_DECODE_ERROR;
         return 0;
     }
-    meth->ext_flags |= SSL_EXT_FLAG_RECEIVED;
+    *flags |= SSL_EXT_FLAG_RECEIVED;
     /* If no parse function set return success */
     if (!meth->parse_cb)
         return 1;
@@ -127,8 +157,21 @@ int custom_ext_add(SSL *s, int server,
     custom_ext_methods *exts = server ? &s->cert->srv_ext : &s->cert->cli_ext;
     custom_ext_method *meth;
     unsigned char *ret = *pret;
+    uint32_t *flags = custom_ext_flags(s, exts);
     size_t i;
 
+    if (exts->meths_count == 0)
+        return 1;
+    if (flags == NULL) {
+        /*
+         * A server that switched to another SSL_CTX has seen none of its
+         * extensions in the ClientHello
+         */
+        if (server)
+            return 1;
+        *al = TLS1_AD_INTERNAL_ERROR;
+        return 0;
+    }
     for (i = 0; i < exts->meths_count; i++) {
         const unsigned char *out = NULL;
         size_t outlen = 0;
@@ -138,7 +181,7 @@ int custom_ext_add(SSL *s, int server,
             /*
              * For ServerHello only send extensions present in ClientHello.
              */
-            if (!(meth->ext_flags & SSL_EXT_FLAG_RECEIVED))
+            if (!(flags[i] & SSL_EXT_FLAG_RECEIVED))
                 continue;
             /* If callback absent for server skip it */
             if (!meth->add_cb)
@@ -164,13 +207,13 @@ int custom_ext_add(SSL *s, int server,
         /*
          * We can't send duplicates: code logic should prevent this.
          */
-        OPENSSL_assert(!(meth->ext_flags & SSL_EXT_FLAG_SENT));
+        OPENSSL_assert(!(flags[i] & SSL_EXT_FLAG_SENT));
         /*
          * Indicate extension has been sent: this is both a sanity check to
          * ensure we don't send duplicate extensions and indicates that it is
          * not an error if the extension is present in ServerHello.
          */
-        meth->ext_flags |= SSL_EXT_FLAG_SENT;
+        flags[i] |= SSL_EXT_FLAG_SENT;
         if (meth->free_cb)
             meth->free_cb(s, meth->ext_type, out, meth->add_arg);
     }
@@ -250,6 +293,8 @@ int SSL_CTX_add_client_custom_ext(SSL_CTX *ctx, unsigned int ext_type,
                                   custom_ext_parse_cb parse_cb,
                                   void *parse_arg)
 {
+    if (!ssl_cert_unshare(&ctx->cert))
+        return 0;
     return custom_ext_meth_add(&ctx->cert->cli_ext, ext_type,
                                add_cb, free_cb, add_arg, parse_cb, parse_arg);
 }
@@ -261,6 +306,8 @@ int SSL_CTX_add_server_custom_ext(SSL_CTX *ctx, unsigned int ext_type,
                                   custom_ext_parse_cb parse_cb,
                                   void *parse_arg)
 {
+    if (!ssl_cert_unshare(&ctx->cert))
+        return 0;
     return custom_ext_meth_add(&ctx->cert->srv_ext, ext_type,
                                add_cb, free_cb, add_arg, parse_cb, parse_arg);
 }
@@ -812,7 +812,7 @@ static int tls1_check_cert_param(SSL *s, X509 *x, int set_ee_md)
     if (set_ee_md && tls1_suiteb(s)) {
         int check_md;
         size_t i;
-        CERT *c = s->cert;
+
         if (curve_id[0])
             return 0;
         /* Check to see we have necessary signing algorithm */
@@ -822,10 +822,10 @@ static int tls1_check_cert_param(SSL *s, X509 *x, int set_ee_md)
             check_md = NID_ecdsa_with_SHA384;
         else
             return 0;           /* Should never happen */
-        for (i = 0; i < c->shared_sigalgslen; i++)
-            if (check_md == c->shared_sigalgs[i].signandhash_nid)
+        for (i = 0; i < s->s3->tmp.shared_sigalgslen; i++)
+            if (check_md == s->s3->tmp.shared_sigalgs[i].signandhash_nid)
                 break;
-        if (i == c->shared_sigalgslen)
+        if (i == s->s3->tmp.shared_sigalgslen)
             return 0;
         if (set_ee_md == 2) {
             if (check_md == NID_ecdsa_with_SHA256)
@@ -1451,9 +1451,8 @@ unsigned char *ssl_add_clienthello_tlsext(SSL *s, unsigned char *buf,
         ret += el;
     }
 #endif
-    custom_ext_init(&s->cert->cli_ext);
     /* Add custom TLS Extensions to ClientHello */
-    if (!custom_ext_add(s, 0, &ret, limit, al))
+    if (!custom_ext_init(s, 0) || !custom_ext_add(s, 0, &ret, limit, al))
         return NULL;
 #ifdef TLSEXT_TYPE_encrypt_then_mac
     s2n(TLSEXT_TYPE_encrypt_then_mac, ret);
@@ -1862,12 +1861,77 @@ static void ssl_check_for_safari(SSL *s, const PACKET *pkt)
 }
 #endif                         /* !OPENSSL_NO_EC */
 
+/*
+ * Index the extension block |pkt| of a ClientHello, including its length
+ * prefix, in one pass. Everything looking for particular extensions later
+ * uses the index instead of parsing the block again. The index points into
+ * the message, so it is only valid while the message is in s->init_buf.
+ */
+int ssl_collect_clienthello_tlsext(SSL *s, const PACKET *pkt, int *al)
+{
+    PACKET block = *pkt, extensions, data;
+    RAW_EXTENSION *exts;
+    unsigned int type;
+    size_t num = 0, max;
+
+    s->s3->tmp.clienthello_exts_num = 0;
+
+    if (PACKET_remaining(&block) == 0)
+        return 1;
+
+    if (!PACKET_get_length_prefixed_2(&block, &extensions)
+            || PACKET_remaining(&block) != 0) {
+        *al = SSL_AD_DECODE_ERROR;
+        return 0;
+    }
+
+    while (PACKET_remaining(&extensions) > 0) {
+        if (!PACKET_get_net_2(&extensions, &type)
+                || !PACKET_get_length_prefixed_2(&extensions, &data)) {
+            *al = SSL_AD_DECODE_ERROR;
+            return 0;
+        }
+        if (num == s->s3->tmp.clienthello_exts_max) {
+            max = num == 0 ? 16 : num * 2;
+            exts = OPENSSL_realloc(s->s3->tmp.clienthello_exts,
+                                   max * sizeof(*exts));
+            if (exts == NULL) {
+                SSLerr(SSL_F_SSL_COLLECT_CLIENTHELLO_TLSEXT,
+                       ERR_R_MALLOC_FAILURE);
+                *al = SSL_AD_INTERNAL_ERROR;
+                return 0;
+            }
+            s->s3->tmp.clienthello_exts = exts;
+            s->s3->tmp.clienthello_exts_max = max;
+        }
+        s->s3->tmp.clienthello_exts[num].type = type;
+        s->s3->tmp.clienthello_exts[num].data = data;
+        num++;
+    }
+
+    s->s3->tmp.clienthello_exts_num = num;
+    return 1;
+}
+
+/* Returns the first extension of |type| in the current ClientHello, if any */
+const RAW_EXTENSION *ssl_get_clienthello_ext(const SSL *s, unsigned int type)
+{
+    size_t i;
+
+    for (i = 0; i < s->s3->tmp.clienthello_exts_num; i++) {
+        if (s->s3->tmp.clienthello_exts[i].type == type)
+            return &s->s3->tmp.clienthello_exts[i];
+    }
+    return NULL;
+}
+
 static int ssl_scan_clienthello_tlsext(SSL *s, PACKET *pkt, int *al)
 {
     unsigned int type;
     unsigned int size;
     unsigned int len;
     unsigned char *data;
+    size_t i;
     int renegotiate_seen = 0;
 
     s->servername_done = 0;
@@ -1902,27 +1966,16 @@ static int ssl_scan_clienthello_tlsext(SSL *s, PACKET *pkt, int *al)
 
     s->srtp_profile = NULL;
 
-    if (PACKET_remaining(pkt) == 0)
-        goto ri_check;
+    for (i = 0; i < s->s3->tmp.clienthello_exts_num; i++) {
+        PACKET subpkt = s->s3->tmp.clienthello_exts[i].data;
 
-    if (!PACKET_get_net_2(pkt, &len))
-        goto err;
-
-    if (PACKET_remaining(pkt) != len)
-        goto err;
-
-    while (PACKET_get_net_2(pkt, &type) && PACKET_get_net_2(pkt, &size)) {
-        PACKET subpkt;
-
-        if (!PACKET_peek_bytes(pkt, &data, size))
-            goto err;
+        type = s->s3->tmp.clienthello_exts[i].type;
+        size = PACKET_remaining(&subpkt);
+        data = PACKET_data(&subpkt);
 
         if (s->tlsext_debug_cb)
             s->tlsext_debug_cb(s, 0, type, data, size, s->tlsext_debug_arg);
 
-        if (!PACKET_get_sub_packet(pkt, &subpkt, size))
-            goto err;
-
         if (type == TLSEXT_TYPE_renegotiate) {
             if (!ssl_parse_clienthello_renegotiate_ext(s, &subpkt, al))
                 return 0;
@@ -2285,12 +2338,6 @@ static int ssl_scan_clienthello_tlsext(SSL *s, PACKET *pkt, int *al)
         }
     }
 
-    /* Spurious data on the end */
-    if (PACKET_remaining(pkt) != 0)
-        goto err;
-
- ri_check:
-
     /* Need RI if renegotiating */
 
     if (!renegotiate_seen && s->renegotiate &&
@@ -2310,7 +2357,12 @@ err:
 int ssl_parse_clienthello_tlsext(SSL *s, PACKET *pkt)
 {
     int al = -1;
-    custom_ext_init(&s->cert->srv_ext);
+
+    if (!custom_ext_init(s, 1)) {
+        SSLerr(SSL_F_SSL_PARSE_CLIENTHELLO_TLSEXT, ERR_R_MALLOC_FAILURE);
+        ssl3_send_alert(s, SSL3_AL_FATAL, SSL_AD_INTERNAL_ERROR);
+        return 0;
+    }
     if (ssl_scan_clienthello_tlsext(s, pkt, &al) <= 0) {
         ssl3_send_alert(s, SSL3_AL_FATAL, al);
         return 0;
@@ -2703,9 +2755,9 @@ int tls1_set_server_sigalgs(SSL *s)
     int al;
     size_t i;
     /* Clear any shared sigtnature algorithms */
-    OPENSSL_free(s->cert->shared_sigalgs);
-    s->cert->shared_sigalgs = NULL;
-    s->cert->shared_sigalgslen = 0;
+    OPENSSL_free(s->s3->tmp.shared_sigalgs);
+    s->s3->tmp.shared_sigalgs = NULL;
+    s->s3->tmp.shared_sigalgslen = 0;
     /* Clear certificate digests and validity flags */
     for (i = 0; i < SSL_PKEY_NUM; i++) {
         s->s3->tmp.md[i] = NULL;
@@ -2720,7 +2772,7 @@ int tls1_set_server_sigalgs(SSL *s)
             goto err;
         }
         /* Fatal error is no shared signature algorithms */
-        if (!s->cert->shared_sigalgs) {
+        if (!s->s3->tmp.shared_sigalgs) {
             SSLerr(SSL_F_TLS1_SET_SERVER_SIGALGS,
                    SSL_R_NO_SHARED_SIGATURE_ALGORITHMS);
             al = SSL_AD_ILLEGAL_PARAMETER;
@@ -2759,7 +2811,10 @@ int ssl_check_clienthello_tlsext_late(SSL *s)
          * Set current certificate to one we will use so SSL_get_certificate
          * et al can pick it up.
          */
-        s->cert->key = certpkey;
+        if (!ssl_cert_set_key(&s->cert, certpkey)) {
+            ret = SSL_TLSEXT_ERR_ALERT_FATAL;
+            goto err;
+        }
         r = s->ctx->tlsext_status_cb(s, s->ctx->tlsext_status_arg);
         switch (r) {
             /* We don't want to send a status request response */
@@ -2779,6 +2834,21 @@ int ssl_check_clienthello_tlsext_late(SSL *s)
             al = SSL_AD_INTERNAL_ERROR;
             goto err;
         }
+    } else if ((s->tlsext_status_type != -1) && s->ctx
+               && s->ctx->ocsp_staples) {
+        /* No callback: use a cached response for the certificate, if any */
+        CERT_PKEY *certpkey;
+        certpkey = ssl_get_server_send_pkey(s);
+        s->tlsext_status_expected = 0;
+        if (certpkey != NULL) {
+            if (!tls1_ocsp_staple_set(s, certpkey->x509)) {
+                ret = SSL_TLSEXT_ERR_ALERT_FATAL;
+                al = SSL_AD_INTERNAL_ERROR;
+                goto err;
+            }
+            if (s->tlsext_ocsp_resp)
+                s->tlsext_status_expected = 1;
+        }
     } else
         s->tlsext_status_expected = 0;
 
@@ -2897,7 +2967,6 @@ int ssl_parse_serverhello_tlsext(SSL *s, PACKET *pkt)
  * secret.
  *
  *   session_id: ClientHello session ID.
- *   ext: ClientHello extensions (including length prefix)
  *   ret: (output) on return, if a ticket was decrypted, then this is set to
  *       point to the resulting session.
  *
@@ -2925,12 +2994,10 @@ int ssl_parse_serverhello_tlsext(SSL *s, PACKET *pkt)
  *   For extended master secret flag is set if the extension is present.
  *
  */
-int tls_check_serverhello_tlsext_early(SSL *s, const PACKET *ext,
-                                       const PACKET *session_id,
+int tls_check_serverhello_tlsext_early(SSL *s, const PACKET *session_id,
                                        SSL_SESSION **ret)
 {
-    unsigned int i;
-    PACKET local_ext = *ext;
+    size_t i;
     int retv = -1;
 
     int have_ticket = 0;
@@ -2947,26 +3014,13 @@ int tls_check_serverhello_tlsext_early(SSL *s, const PACKET *ext,
     if ((s->version <= SSL3_VERSION))
         return 0;
 
-    if (!PACKET_get_net_2(&local_ext, &i)) {
-        retv = 0;
-        goto end;
-    }
-    while (PACKET_remaining(&local_ext) >= 4) {
-        unsigned int type, size;
+    for (i = 0; i < s->s3->tmp.clienthello_exts_num; i++) {
+        unsigned int type = s->s3->tmp.clienthello_exts[i].type;
+        const PACKET *ext = &s->s3->tmp.clienthello_exts[i].data;
 
-        if (!PACKET_get_net_2(&local_ext, &type)
-                || !PACKET_get_net_2(&local_ext, &size)) {
-            /* Shouldn't ever happen */
-            retv = -1;
-            goto end;
-        }
-        if (PACKET_remaining(&local_ext) < size) {
-            retv = 0;
-            goto end;
-        }
         if (type == TLSEXT_TYPE_session_ticket && use_ticket) {
             int r;
-            unsigned char *etick;
+            size_t size = PACKET_remaining(ext);
 
             /* Duplicate extension */
             if (have_ticket != 0) {
@@ -2994,12 +3048,8 @@ int tls_check_serverhello_tlsext_early(SSL *s, const PACKET *ext,
                 retv = 2;
                 continue;
             }
-            if (!PACKET_get_bytes(&local_ext, &etick, size)) {
-                /* Shouldn't ever happen */
-                retv = -1;
-                goto end;
-            }
-            r = tls_decrypt_ticket(s, etick, size, PACKET_data(session_id),
+            r = tls_decrypt_ticket(s, PACKET_data(ext), size,
+                                   PACKET_data(session_id),
                                    PACKET_remaining(session_id), ret);
             switch (r) {
             case 2:            /* ticket couldn't be decrypted */
@@ -3017,14 +3067,8 @@ int tls_check_serverhello_tlsext_early(SSL *s, const PACKET *ext,
                 retv = -1;
                 break;
             }
-            continue;
-        } else {
-            if (type == TLSEXT_TYPE_extended_master_secret)
-                s->s3->flags |= TLS1_FLAGS_RECEIVED_EXTMS;
-            if (!PACKET_forward(&local_ext, size)) {
-                retv = -1;
-                goto end;
-            }
+        } else if (type == TLSEXT_TYPE_extended_master_secret) {
+            s->s3->flags |= TLS1_FLAGS_RECEIVED_EXTMS;
         }
     }
     if (have_ticket == 0)
@@ -3057,7 +3101,8 @@ static int tls_decrypt_ticket(SSL *s, const unsigned char *etick,
     SSL_SESSION *sess;
     unsigned char *sdec;
     const unsigned char *p;
-    int slen, mlen, renew_ticket = 0;
+    int slen, mlen, rv, renew_ticket = 0;
+    unsigned char *nctick = (unsigned char *)etick;
     unsigned char tick_hmac[EVP_MAX_MD_SIZE];
     HMAC_CTX *hctx = NULL;
     EVP_CIPHER_CTX *ctx;
@@ -3070,28 +3115,24 @@ static int tls_decrypt_ticket(SSL *s, const unsigned char *etick,
     if (hctx == NULL)
         return -2;
     ctx = EVP_CIPHER_CTX_new();
-    if (tctx->tlsext_ticket_key_cb) {
-        unsigned char *nctick = (unsigned char *)etick;
-        int rv = tctx->tlsext_ticket_key_cb(s, nctick, nctick + 16,
-                                            ctx, hctx, 0);
-        if (rv < 0)
-            return -1;
-        if (rv == 0)
-            return 2;
-        if (rv == 2)
-            renew_ticket = 1;
-    } else {
-        /* Check key name matches */
-        if (memcmp(etick, tctx->tlsext_tick_key_name, 16))
-            return 2;
-        if (HMAC_Init_ex(hctx, tctx->tlsext_tick_hmac_key, 16,
-                         EVP_sha256(), NULL) <= 0
-                || EVP_DecryptInit_ex(ctx, EVP_aes_128_cbc(), NULL,
-                                      tctx->tlsext_tick_aes_key,
-                                      etick + 16) <= 0) {
-            goto err;
-       }
+    if (ctx == NULL) {
+        HMAC_CTX_free(hctx);
+        return -2;
+    }
+    /* Without a callback look the key name up in the built in keys */
+    if (tctx->tlsext_ticket_key_cb)
+        rv = tctx->tlsext_ticket_key_cb(s, nctick, nctick + 16, ctx, hctx, 0);
+    else
+        rv = tls1_ticket_ring_init(tctx, nctick, nctick + 16, ctx, hctx, 0);
+    if (rv < 0)
+        goto err;
+    if (rv == 0) {
+        EVP_CIPHER_CTX_free(ctx);
+        HMAC_CTX_free(hctx);
+        return 2;
     }
+    if (rv == 2)
+        renew_ticket = 1;
     /*
      * Attempt to process session ticket, first conduct sanity and integrity
      * checks on ticket.
@@ -3443,9 +3484,9 @@ static int tls1_set_shared_sigalgs(SSL *s)
     CERT *c = s->cert;
     unsigned int is_suiteb = tls1_suiteb(s);
 
-    OPENSSL_free(c->shared_sigalgs);
-    c->shared_sigalgs = NULL;
-    c->shared_sigalgslen = 0;
+    OPENSSL_free(s->s3->tmp.shared_sigalgs);
+    s->s3->tmp.shared_sigalgs = NULL;
+    s->s3->tmp.shared_sigalgslen = 0;
     /* If client use client signature algorithms if not NULL */
     if (!s->server && c->client_sigalgs && !is_suiteb) {
         conf = c->client_sigalgs;
@@ -3475,8 +3516,8 @@ static int tls1_set_shared_sigalgs(SSL *s)
     } else {
         salgs = NULL;
     }
-    c->shared_sigalgs = salgs;
-    c->shared_sigalgslen = nmatch;
+    s->s3->tmp.shared_sigalgs = salgs;
+    s->s3->tmp.shared_sigalgslen = nmatch;
     return 1;
 }
 
@@ -3508,7 +3549,6 @@ int tls1_process_sigalgs(SSL *s)
     const EVP_MD *md;
     const EVP_MD **pmd = s->s3->tmp.md;
     uint32_t *pvalid = s->s3->tmp.valid_flags;
-    CERT *c = s->cert;
     TLS_SIGALGS *sigptr;
     if (!tls1_set_shared_sigalgs(s))
         return 0;
@@ -3521,9 +3561,9 @@ int tls1_process_sigalgs(SSL *s)
          */
         const unsigned char *sigs = NULL;
         if (s->server)
-            sigs = c->conf_sigalgs;
+            sigs = s->cert->conf_sigalgs;
         else
-            sigs = c->client_sigalgs;
+            sigs = s->cert->client_sigalgs;
         if (sigs) {
             idx = tls12_get_pkey_idx(sigs[1]);
             md = tls12_get_hash(sigs[0]);
@@ -3537,8 +3577,8 @@ int tls1_process_sigalgs(SSL *s)
     }
 #endif
 
-    for (i = 0, sigptr = c->shared_sigalgs;
-         i < c->shared_sigalgslen; i++, sigptr++) {
+    for (i = 0, sigptr = s->s3->tmp.shared_sigalgs;
+         i < s->s3->tmp.shared_sigalgslen; i++, sigptr++) {
         idx = tls12_get_pkey_idx(sigptr->rsign);
         if (idx > 0 && pmd[idx] == NULL) {
             md = tls12_get_hash(sigptr->rhash);
@@ -3611,8 +3651,8 @@ int SSL_get_shared_sigalgs(SSL *s, int idx,
                            int *psign, int *phash, int *psignhash,
                            unsigned char *rsig, unsigned char *rhash)
 {
-    TLS_SIGALGS *shsigalgs = s->cert->shared_sigalgs;
-    if (!shsigalgs || idx >= (int)s->cert->shared_sigalgslen)
+    TLS_SIGALGS *shsigalgs = s->s3->tmp.shared_sigalgs;
+    if (!shsigalgs || idx >= (int)s->s3->tmp.shared_sigalgslen)
         return 0;
     shsigalgs += idx;
     if (phash)
@@ -3625,7 +3665,7 @@ int SSL_get_shared_sigalgs(SSL *s, int idx,
         *rsig = shsigalgs->rsign;
     if (rhash)
         *rhash = shsigalgs->rhash;
-    return s->cert->shared_sigalgslen;
+    return s->s3->tmp.shared_sigalgslen;
 }
 
 #ifndef OPENSSL_NO_HEARTBEATS
@@ -3894,7 +3934,7 @@ int tls1_set_sigalgs(CERT *c, const int *psig_nids, size_t salglen,
     return 0;
 }
 
-static int tls1_check_sig_alg(CERT *c, X509 *x, int default_nid)
+static int tls1_check_sig_alg(SSL *s, X509 *x, int default_nid)
 {
     int sig_nid;
     size_t i;
@@ -3903,8 +3943,8 @@ static int tls1_check_sig_alg(CERT *c, X509 *x, int default_nid)
     sig_nid = X509_get_signature_nid(x);
     if (default_nid)
         return sig_nid == default_nid ? 1 : 0;
-    for (i = 0; i < c->shared_sigalgslen; i++)
-        if (sig_nid == c->shared_sigalgs[i].signandhash_nid)
+    for (i = 0; i < s->s3->tmp.shared_sigalgslen; i++)
+        if (sig_nid == s->s3->tmp.shared_sigalgs[i].signandhash_nid)
             return 1;
     return 0;
 }
@@ -4066,14 +4106,14 @@ int tls1_check_chain(SSL *s, X509 *x, EVP_PKEY *pk, STACK_OF(X509) *chain,
             }
         }
         /* Check signature algorithm of each cert in chain */
-        if (!tls1_check_sig_alg(c, x, default_nid)) {
+        if (!tls1_check_sig_alg(s, x, default_nid)) {
             if (!check_flags)
                 goto end;
         } else
             rv |= CERT_PKEY_EE_SIGNATURE;
         rv |= CERT_PKEY_CA_SIGNATURE;
         for (i = 0; i < sk_X509_num(chain); i++) {
-            if (!tls1_check_sig_alg(c, sk_X509_value(chain, i), default_nid)) {
+            if (!tls1_check_sig_alg(s, sk_X509_value(chain, i), default_nid)) {
                 if (check_flags) {
                     rv &= ~CERT_PKEY_CA_SIGNATURE;
                     break;
@@ -0,0 +1,358 @@
+/* ssl/t1_ocsp.c */
+/* ====================================================================
+ * Copyright (c) 2016 The OpenSSL Project.  All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * 3. All advertising materials mentioning features or use of this
+ *    software must display the following acknowledgment:
+ *    "This product includes software developed by the OpenSSL Project
+ *    for use in the OpenSSL Toolkit. (http://www.openssl.org/)"
+ *
+ * 4. The names "OpenSSL Toolkit" and "OpenSSL Project" must not be used to
+ *    endorse or promote products derived from this software without
+ *    prior written permission. For written permission, please contact
+ *    openssl-core@openssl.org.
+ *
+ * 5. Products derived from this software may not be called "OpenSSL"
+ *    nor may "OpenSSL" appear in their names without prior written
+ *    permission of the OpenSSL Project.
+ *
+ * 6. Redistributions of any form whatsoever must retain the following
+ *    acknowledgment:
+ *    "This product includes software developed by the OpenSSL Project
+ *    for use in the OpenSSL Toolkit (http://www.openssl.org/)"
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE OpenSSL PROJECT ``AS IS'' AND ANY
+ * EXPRESSED OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE OpenSSL PROJECT OR
+ * ITS CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT
+ * NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ * ====================================================================
+ *
+ * This product includes cryptographic software written by Eric Young
+ * (eay@cryptsoft.com).  This product includes software written by Tim
+ * Hudson (tjh@cryptsoft.com).
+ *
+ */
+
+/* OCSP response cache for servers doing certificate status stapling */
+
+#include <time.h>
+#include <openssl/ocsp.h>
+#include "ssl_locl.h"
+
+/* Allowed clock skew when checking response validity, in seconds */
+#define OCSP_STAPLE_LEEWAY      300
+
+struct ssl_ocsp_staple_st {
+    /* Certificate the response is for */
+    X509 *x509;
+    /* DER encoded OCSPResponse sent in the CertificateStatus message */
+    unsigned char *resp;
+    int resplen;
+    /* nextUpdate of the response or zero if it has none */
+    time_t expires;
+    /* Time after which the application is asked for a new response */
+    time_t refresh;
+    int refresh_pending;
+};
+
+static void ocsp_staple_free(SSL_OCSP_STAPLE *st)
+{
+    if (st == NULL)
+        return;
+    X509_free(st->x509);
+    OPENSSL_free(st->resp);
+    OPENSSL_free(st);
+}
+
+void tls1_ocsp_staples_free(LHASH_OF(SSL_OCSP_STAPLE) *staples)
+{
+    if (staples == NULL)
+        return;
+    lh_SSL_OCSP_STAPLE_doall(staples, ocsp_staple_free);
+    lh_SSL_OCSP_STAPLE_free(staples);
+}
+
+/*
+ * Staples are keyed by certificate. The subject name hash is cached in the
+ * certificate after its first use, and the serial number makes certificates
+ * with the same subject unlikely to collide.
+ */
+static unsigned long ocsp_staple_hash(const SSL_OCSP_STAPLE *st)
+{
+    ASN1_INTEGER *serial = X509_get_serialNumber(st->x509);
+    unsigned long h = X509_NAME_hash(X509_get_subject_name(st->x509));
+    int i;
+
+    for (i = 0; i < serial->length; i++)
+        h = (h << 5) ^ (h >> 27) ^ serial->data[i];
+    return h;
+}
+
+static int ocsp_staple_cmp(const SSL_OCSP_STAPLE *a, const SSL_OCSP_STAPLE *b)
+{
+    if (a->x509 == b->x509)
+        return 0;
+    return X509_cmp(a->x509, b->x509);
+}
+
+/* Return the cached staple for |x|, called with CRYPTO_LOCK_SSL_CTX held */
+static SSL_OCSP_STAPLE *ocsp_staple_find(LHASH_OF(SSL_OCSP_STAPLE) *staples,
+                                         X509 *x)
+{
+    SSL_OCSP_STAPLE tmp;
+
+    if (staples == NULL)
+        return NULL;
+    tmp.x509 = x;
+    return lh_SSL_OCSP_STAPLE_retrieve(staples, &tmp);
+}
+
+/*
+ * Locate the certificate chain sent with |x|: either the chain of the
+ * matching certificate slot or the SSL_CTX extra certificates.
+ */
+static STACK_OF(X509) *ocsp_staple_chain(SSL_CTX *ctx, X509 *x)
+{
+    int i;
+
+    for (i = 0; i < SSL_PKEY_NUM; i++) {
+        CERT_PKEY *cpk = &ctx->cert->pkeys[i];
+
+        if (cpk->x509 == x && cpk->chain != NULL)
+            return cpk->chain;
+    }
+    return ctx->extra_certs;
+}
+
+/* Return a new reference to the issuer of |x| or NULL if not found */
+static X509 *ocsp_staple_issuer(SSL_CTX *ctx, X509 *x, STACK_OF(X509) *chain)
+{
+    X509_STORE_CTX *sctx;
+    X509 *issuer = NULL;
+    int i;
+
+    for (i = 0; i < sk_X509_num(chain); i++) {
+        X509 *tmp = sk_X509_value(chain, i);
+
+        if (X509_check_issued(tmp, x) == X509_V_OK) {
+            X509_up_ref(tmp);
+            return tmp;
+        }
+    }
+    if (ctx->cert_store == NULL || (sctx = X509_STORE_CTX_new()) == NULL)
+        return NULL;
+    if (X509_STORE_CTX_init(sctx, ctx->cert_store, x, chain)
+        && X509_STORE_CTX_get1_issuer(&issuer, sctx, x) <= 0)
+        issuer = NULL;
+    X509_STORE_CTX_free(sctx);
+    return issuer;
+}
+
+/*
+ * Parse and verify |resp| as an OCSP response for |x|. On success fill in
+ * the validity times of |st|.
+ */
+static int ocsp_staple_check(SSL_CTX *ctx, X509 *x, SSL_OCSP_STAPLE *st,
+                             const unsigned char *resp, long resplen)
+{
+    OCSP_RESPONSE *rsp = NULL;
+    OCSP_BASICRESP *bs = NULL;
+    OCSP_CERTID *id = NULL;
+    STACK_OF(X509) *chain = ocsp_staple_chain(ctx, x);
+    STACK_OF(X509) *issuers = NULL;
+    X509 *issuer = NULL;
+    ASN1_GENERALIZEDTIME *thisupd, *nextupd;
+    int status, reason, day, sec, ret = 0;
+    time_t now;
+
+    if ((rsp = d2i_OCSP_RESPONSE(NULL, &resp, resplen)) == NULL
+        || OCSP_response_status(rsp) != OCSP_RESPONSE_STATUS_SUCCESSFUL
+        || (bs = OCSP_response_get1_basic(rsp)) == NULL) {
+        SSLerr(SSL_F_OCSP_STAPLE_CHECK, SSL_R_INVALID_OCSP_RESPONSE);
+        goto err;
+    }
+    if ((issuer = ocsp_staple_issuer(ctx, x, chain)) == NULL) {
+        SSLerr(SSL_F_OCSP_STAPLE_CHECK, SSL_R_UNABLE_TO_FIND_OCSP_ISSUER);
+        goto err;
+    }
+    if (OCSP_basic_verify(bs, chain, ctx->cert_store, 0) <= 0) {
+        /* As for "openssl ocsp", accept a response signed by the issuer */
+        if ((issuers = sk_X509_new_null()) == NULL
+            || !sk_X509_push(issuers, issuer)
+            || OCSP_basic_verify(bs, issuers, ctx->cert_store,
+                                 OCSP_TRUSTOTHER) <= 0) {
+            SSLerr(SSL_F_OCSP_STAPLE_CHECK, SSL_R_OCSP_RESPONSE_VERIFY_FAILED);
+            goto err;
+        }
+        ERR_clear_error();
+    }
+    if ((id = OCSP_cert_to_id(NULL, x, issuer)) == NULL) {
+        SSLerr(SSL_F_OCSP_STAPLE_CHECK, ERR_R_MALLOC_FAILURE);
+        goto err;
+    }
+    if (!OCSP_resp_find_status(bs, id, &status, &reason, NULL,
+                               &thisupd, &nextupd)
+        || status != V_OCSP_CERTSTATUS_GOOD
+        || !OCSP_check_validity(thisupd, nextupd, OCSP_STAPLE_LEEWAY, -1)) {
+        SSLerr(SSL_F_OCSP_STAPLE_CHECK, SSL_R_INVALID_OCSP_RESPONSE);
+        goto err;
+    }
+
+    now = time(NULL);
+    st->expires = 0;
+    st->refresh = 0;
+    if (nextupd != NULL) {
+        if (!ASN1_TIME_diff(&day, &sec, NULL, nextupd)) {
+            SSLerr(SSL_F_OCSP_STAPLE_CHECK, SSL_R_INVALID_OCSP_RESPONSE);
+            goto err;
+        }
+        st->expires = now + (time_t)day * 24 * 60 * 60 + sec;
+        /* Ask for a new response half way through the remaining lifetime */
+        st->refresh = now + (st->expires - now) / 2;
+    }
+    ret = 1;
+
+ err:
+    OCSP_CERTID_free(id);
+    sk_X509_free(issuers);
+    X509_free(issuer);
+    OCSP_BASICRESP_free(bs);
+    OCSP_RESPONSE_free(rsp);
+    return ret;
+}
+
+int SSL_CTX_set1_ocsp_staple(SSL_CTX *ctx, X509 *x,
+                             const unsigned char *resp, long resplen)
+{
+    SSL_OCSP_STAPLE *st, *old;
+
+    if (x == NULL && ctx->cert->key != NULL)
+        x = ctx->cert->key->x509;
+    if (x == NULL) {
+        SSLerr(SSL_F_SSL_CTX_SET1_OCSP_STAPLE, SSL_R_NO_CERTIFICATE_ASSIGNED);
+        return 0;
+    }
+    if (resp == NULL || resplen <= 0 || resplen > 0xfffff0) {
+        SSLerr(SSL_F_SSL_CTX_SET1_OCSP_STAPLE, SSL_R_INVALID_OCSP_RESPONSE);
+        return 0;
+    }
+    st = OPENSSL_zalloc(sizeof(*st));
+    if (st == NULL) {
+        SSLerr(SSL_F_SSL_CTX_SET1_OCSP_STAPLE, ERR_R_MALLOC_FAILURE);
+        return 0;
+    }
+    if (!ocsp_staple_check(ctx, x, st, resp, resplen)) {
+        OPENSSL_free(st);
+        return 0;
+    }
+    st->resp = OPENSSL_memdup(resp, resplen);
+    if (st->resp == NULL) {
+        OPENSSL_free(st);
+        SSLerr(SSL_F_SSL_CTX_SET1_OCSP_STAPLE, ERR_R_MALLOC_FAILURE);
+        return 0;
+    }
+    st->resplen = (int)resplen;
+    X509_up_ref(x);
+    st->x509 = x;
+
+    CRYPTO_w_lock(CRYPTO_LOCK_SSL_CTX);
+    if (ctx->ocsp_staples == NULL)
+        ctx->ocsp_staples = lh_SSL_OCSP_STAPLE_new(ocsp_staple_hash,
+                                                   ocsp_staple_cmp);
+    if (ctx->ocsp_staples == NULL) {
+        CRYPTO_w_unlock(CRYPTO_LOCK_SSL_CTX);
+        ocsp_staple_free(st);
+        SSLerr(SSL_F_SSL_CTX_SET1_OCSP_STAPLE, ERR_R_MALLOC_FAILURE);
+        return 0;
+    }
+    old = lh_SSL_OCSP_STAPLE_insert(ctx->ocsp_staples, st);
+    if (old == NULL && lh_SSL_OCSP_STAPLE_error(ctx->ocsp_staples)) {
+        CRYPTO_w_unlock(CRYPTO_LOCK_SSL_CTX);
+        ocsp_staple_free(st);
+        SSLerr(SSL_F_SSL_CTX_SET1_OCSP_STAPLE, ERR_R_MALLOC_FAILURE);
+        return 0;
+    }
+    CRYPTO_w_unlock(CRYPTO_LOCK_SSL_CTX);
+    ocsp_staple_free(old);
+    return 1;
+}
+
+void SSL_CTX_set_ocsp_staple_refresh_cb(SSL_CTX *ctx,
+                                        void (*cb) (SSL_CTX *ctx, X509 *x,
+                                                    void *arg),
+                                        void *arg)
+{
+    ctx->ocsp_staple_refresh_cb = cb;
+    ctx->ocsp_staple_refresh_arg = arg;
+}
+
+/*
+ * Set the CertificateStatus response of |s| to the cached response for |x|,
+ * if there is a current one. The response is already verified so this is
+ * just a copy. Returns 0 on allocation failure, 1 otherwise.
+ */
+int tls1_ocsp_staple_set(SSL *s, X509 *x)
+{
+    SSL_CTX *ctx = s->ctx;
+    SSL_OCSP_STAPLE *st;
+    unsigned char *resp = NULL;
+    int resplen = 0, refresh = 0;
+    time_t now = time(NULL);
+
+    CRYPTO_r_lock(CRYPTO_LOCK_SSL_CTX);
+    st = ocsp_staple_find(ctx->ocsp_staples, x);
+    if (st != NULL) {
+        if (st->expires == 0 || now < st->expires) {
+            resp = OPENSSL_memdup(st->resp, st->resplen);
+            if (resp == NULL) {
+                CRYPTO_r_unlock(CRYPTO_LOCK_SSL_CTX);
+                return 0;
+            }
+            resplen = st->resplen;
+        }
+        refresh = st->refresh != 0 && now >= st->refresh
+                  && !st->refresh_pending;
+    }
+    CRYPTO_r_unlock(CRYPTO_LOCK_SSL_CTX);
+
+    if (refresh && ctx->ocsp_staple_refresh_cb != NULL) {
+        /*
+         * Only ask once per response: check again with the write lock, the
+         * response may have been replaced in the meantime.
+         */
+        CRYPTO_w_lock(CRYPTO_LOCK_SSL_CTX);
+        st = ocsp_staple_find(ctx->ocsp_staples, x);
+        refresh = st != NULL && st->refresh != 0 && now >= st->refresh
+                  && !st->refresh_pending;
+        if (refresh)
+            st->refresh_pending = 1;
+        CRYPTO_w_unlock(CRYPTO_LOCK_SSL_CTX);
+        if (refresh)
+            ctx->ocsp_staple_refresh_cb(ctx, x, ctx->ocsp_staple_refresh_arg);
+    }
+
+    OPENSSL_free(s->tlsext_ocsp_resp);
+    s->tlsext_ocsp_resp = resp;
+    s->tlsext_ocsp_resplen = resp != NULL ? resplen : -1;
+    return 1;
+}
@@ -0,0 +1,348 @@
+/* ssl/t1_ticket.c */
+/* ====================================================================
+ * Copyright (c) 2016 The OpenSSL Project.  All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * 3. All advertising materials mentioning features or use of this
+ *    software must display the following acknowledgment:
+ *    "This product includes software developed by the OpenSSL Project
+ *    for use in the OpenSSL Toolkit. (http://www.openssl.org/)"
+ *
+ * 4. The names "OpenSSL Toolkit" and "OpenSSL Project" must not be used to
+ *    endorse or promote products derived from this software without
+ *    prior written permission. For written permission, please contact
+ *    openssl-core@openssl.org.
+ *
+ * 5. Products derived from this software may not be called "OpenSSL"
+ *    nor may "OpenSSL" appear in their names without prior written
+ *    permission of the OpenSSL Project.
+ *
+ * 6. Redistributions of any form whatsoever must retain the following
+ *    acknowledgment:
+ *    "This product includes software developed by the OpenSSL Project
+ *    for use in the OpenSSL Toolkit (http://www.openssl.org/)"
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE OpenSSL PROJECT ``AS IS'' AND ANY
+ * EXPRESSED OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE OpenSSL PROJECT OR
+ * ITS CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT
+ * NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ * ====================================================================
+ *
+ * This product includes cryptographic software written by Eric Young
+ * (eay@cryptsoft.com).  This product includes software written by Tim
+ * Hudson (tjh@cryptsoft.com).
+ *
+ */
+
+/*
+ * Built in session ticket keys. The AES key schedules and the HMAC inner
+ * and outer digest states are computed once per key; every ticket then
+ * starts from a copy of them.
+ *
+ * An SSL_CTX keeps a ring of keys: the newest one encrypts new tickets,
+ * older ones only decrypt, and tickets under those are renewed. Handshakes
+ * look keys up under the SSL_CTX's read lock, rotation replaces them under
+ * its write lock.
+ */
+
+#include <string.h>
+#include <openssl/rand.h>
+#include "ssl_locl.h"
+
+/* Most keys a ring holds, and the size of its index (a power of two) */
+#define TICKET_RING_MAX         16
+#define TICKET_INDEX_SIZE       32
+
+/* Keys kept until SSL_CTX_set_tlsext_ticket_key_ring_size() says otherwise */
+#define TICKET_RING_DEFAULT     2
+
+typedef struct ssl_ticket_key_st {
+    unsigned char name[16];
+    unsigned char hmac_key[16];
+    unsigned char aes_key[16];
+    /* Contexts with the keys set up but no IV */
+    EVP_CIPHER_CTX *enc_ctx;
+    EVP_CIPHER_CTX *dec_ctx;
+    HMAC_CTX *hmac_ctx;
+} SSL_TICKET_KEY;
+
+struct ssl_ticket_ring_st {
+    /* keys[0] encrypts, all of them decrypt */
+    SSL_TICKET_KEY *keys[TICKET_RING_MAX];
+    size_t num;
+    size_t max;
+    /* Open addressing index by key name: position in keys plus one, or 0 */
+    unsigned char index[TICKET_INDEX_SIZE];
+};
+
+static void ticket_key_free(SSL_TICKET_KEY *tk)
+{
+    if (tk == NULL)
+        return;
+    EVP_CIPHER_CTX_free(tk->enc_ctx);
+    EVP_CIPHER_CTX_free(tk->dec_ctx);
+    HMAC_CTX_free(tk->hmac_ctx);
+    OPENSSL_clear_free(tk, sizeof(*tk));
+}
+
+/*
+ * Create a ticket key from |keys|: 16 bytes of key name, then the HMAC
+ * and AES keys, in the layout of SSL_CTX_set_tlsext_ticket_keys().
+ */
+static SSL_TICKET_KEY *ticket_key_new(const unsigned char *keys)
+{
+    SSL_TICKET_KEY *tk = OPENSSL_zalloc(sizeof(*tk));
+
+    if (tk == NULL)
+        return NULL;
+    memcpy(tk->name, keys, 16);
+    memcpy(tk->hmac_key, keys + 16, 16);
+    memcpy(tk->aes_key, keys + 32, 16);
+    tk->enc_ctx = EVP_CIPHER_CTX_new();
+    tk->dec_ctx = EVP_CIPHER_CTX_new();
+    tk->hmac_ctx = HMAC_CTX_new();
+    if (tk->enc_ctx == NULL || tk->dec_ctx == NULL || tk->hmac_ctx == NULL
+        || !EVP_EncryptInit_ex(tk->enc_ctx, EVP_aes_128_cbc(), NULL,
+                               tk->aes_key, NULL)
+        || !EVP_DecryptInit_ex(tk->dec_ctx, EVP_aes_128_cbc(), NULL,
+                               tk->aes_key, NULL)
+        || !HMAC_Init_ex(tk->hmac_ctx, tk->hmac_key, 16, EVP_sha256(),
+                         NULL)) {
+        ticket_key_free(tk);
+        return NULL;
+    }
+    return tk;
+}
+
+/*
+ * Set up |ctx| and |hctx| to encrypt (|enc| == 1) or decrypt a ticket with
+ * |iv| under |tk|, the same as tlsext_ticket_key_cb would.
+ */
+static int ticket_key_init(const SSL_TICKET_KEY *tk, EVP_CIPHER_CTX *ctx,
+                           HMAC_CTX *hctx, const unsigned char *iv, int enc)
+{
+    return EVP_CIPHER_CTX_copy(ctx, enc ? tk->enc_ctx : tk->dec_ctx)
+        && EVP_CipherInit_ex(ctx, NULL, NULL, NULL, iv, enc)
+        && HMAC_CTX_copy(hctx, tk->hmac_ctx);
+}
+
+/* FNV-1a of a key name, reduced to an index slot */
+static size_t ticket_name_hash(const unsigned char *name)
+{
+    uint32_t h = 0x811c9dc5;
+    int i;
+
+    for (i = 0; i < 16; i++)
+        h = (h ^ name[i]) * 0x01000193;
+    return (h ^ (h >> 16)) & (TICKET_INDEX_SIZE - 1);
+}
+
+static void ticket_ring_reindex(SSL_TICKET_RING *ring)
+{
+    size_t i, slot;
+
+    memset(ring->index, 0, sizeof(ring->index));
+    for (i = 0; i < ring->num; i++) {
+        slot = ticket_name_hash(ring->keys[i]->name);
+        while (ring->index[slot] != 0)
+            slot = (slot + 1) & (TICKET_INDEX_SIZE - 1);
+        ring->index[slot] = (unsigned char)(i + 1);
+    }
+}
+
+/* Position of the key called |name| in |ring|, or -1 */
+static int ticket_ring_find(const SSL_TICKET_RING *ring,
+                            const unsigned char *name)
+{
+    size_t slot = ticket_name_hash(name);
+    int i;
+
+    while ((i = ring->index[slot]) != 0) {
+        if (memcmp(ring->keys[i - 1]->name, name, 16) == 0)
+            return i - 1;
+        slot = (slot + 1) & (TICKET_INDEX_SIZE - 1);
+    }
+    return -1;
+}
+
+SSL_TICKET_RING *tls1_ticket_ring_new(void)
+{
+    SSL_TICKET_RING *ring = OPENSSL_zalloc(sizeof(*ring));
+
+    if (ring != NULL)
+        ring->max = TICKET_RING_DEFAULT;
+    return ring;
+}
+
+void tls1_ticket_ring_free(SSL_TICKET_RING *ring)
+{
+    size_t i;
+
+    if (ring == NULL)
+        return;
+    for (i = 0; i < ring->num; i++)
+        ticket_key_free(ring->keys[i]);
+    OPENSSL_free(ring);
+}
+
+/*
+ * Make the key built from |keys| the one encrypting new tickets. With
+ * |replace| all other keys are dropped, otherwise the oldest ones beyond
+ * the ring size are. If |keys| is NULL a random key is used.
+ */
+int tls1_ticket_ring_push(SSL_CTX *ctx, const unsigned char *keys,
+                          int replace)
+{
+    SSL_TICKET_RING *ring = ctx->tlsext_tick_ring;
+    SSL_TICKET_KEY *tk, *old[TICKET_RING_MAX];
+    unsigned char rkeys[48];
+    size_t i, nold = 0;
+    int pos;
+
+    if (keys == NULL) {
+        if (RAND_bytes(rkeys, sizeof(rkeys)) <= 0)
+            return 0;
+        keys = rkeys;
+    }
+    tk = ticket_key_new(keys);
+    OPENSSL_cleanse(rkeys, sizeof(rkeys));
+    if (tk == NULL)
+        return 0;
+
+    CRYPTO_THREAD_write_lock(ctx->lock);
+    /* A key reused under the same name is moved to the front */
+    pos = ticket_ring_find(ring, tk->name);
+    if (pos >= 0) {
+        old[nold++] = ring->keys[pos];
+        memmove(ring->keys + pos, ring->keys + pos + 1,
+                (ring->num - pos - 1) * sizeof(ring->keys[0]));
+        ring->num--;
+    }
+    while (ring->num > 0 && (replace || ring->num >= ring->max))
+        old[nold++] = ring->keys[--ring->num];
+    memmove(ring->keys + 1, ring->keys, ring->num * sizeof(ring->keys[0]));
+    ring->keys[0] = tk;
+    ring->num++;
+    ticket_ring_reindex(ring);
+    CRYPTO_THREAD_unlock(ctx->lock);
+
+    for (i = 0; i < nold; i++)
+        ticket_key_free(old[i]);
+    return 1;
+}
+
+/* Keep at most |max| keys in the ring of |ctx| */
+int tls1_ticket_ring_set_max(SSL_CTX *ctx, size_t max)
+{
+    SSL_TICKET_RING *ring = ctx->tlsext_tick_ring;
+    SSL_TICKET_KEY *old[TICKET_RING_MAX];
+    size_t i, nold = 0;
+
+    if (max == 0 || max > TICKET_RING_MAX)
+        return 0;
+    CRYPTO_THREAD_write_lock(ctx->lock);
+    ring->max = max;
+    while (ring->num > max)
+        old[nold++] = ring->keys[--ring->num];
+    ticket_ring_reindex(ring);
+    CRYPTO_THREAD_unlock(ctx->lock);
+
+    for (i = 0; i < nold; i++)
+        ticket_key_free(old[i]);
+    return 1;
+}
+
+/* Write the 48 bytes the current key was created from to |keys| */
+int tls1_ticket_ring_get(SSL_CTX *ctx, unsigned char *keys)
+{
+    SSL_TICKET_RING *ring = ctx->tlsext_tick_ring;
+    SSL_TICKET_KEY *tk;
+    int ret = 0;
+
+    CRYPTO_THREAD_read_lock(ctx->lock);
+    if (ring->num > 0) {
+        tk = ring->keys[0];
+        memcpy(keys, tk->name, 16);
+        memcpy(keys + 16, tk->hmac_key, 16);
+        memcpy(keys + 32, tk->aes_key, 16);
+        ret = 1;
+    }
+    CRYPTO_THREAD_unlock(ctx->lock);
+    return ret;
+}
+
+/*
+ * Look up or choose a key and set up |ectx| and |hctx| with it, with the
+ * arguments and return values of tlsext_ticket_key_cb: 1 if the contexts
+ * are set, 2 if they are but the ticket is under an older key and should
+ * be renewed, 0 if there is no such key and -1 on error.
+ */
+int tls1_ticket_ring_init(SSL_CTX *ctx, unsigned char *name,
+                          unsigned char *iv, EVP_CIPHER_CTX *ectx,
+                          HMAC_CTX *hctx, int enc)
+{
+    SSL_TICKET_RING *ring = ctx->tlsext_tick_ring;
+    int pos = 0, ret = 0;
+
+    if (enc && RAND_bytes(iv, 16) <= 0)
+        return -1;
+    CRYPTO_THREAD_read_lock(ctx->lock);
+    if (!enc)
+        pos = ticket_ring_find(ring, name);
+    else if (ring->num == 0)
+        pos = -1;
+    if (pos >= 0) {
+        if (enc)
+            memcpy(name, ring->keys[0]->name, 16);
+        if (!ticket_key_init(ring->keys[pos], ectx, hctx, iv, enc))
+            ret = -1;
+        else
+            ret = pos == 0 ? 1 : 2;
+    }
+    CRYPTO_THREAD_unlock(ctx->lock);
+    return ret;
+}
+
+int SSL_CTX_rotate_tlsext_ticket_key(SSL_CTX *ctx, const unsigned char *keys,
+                                     size_t keylen)
+{
+    if (keys != NULL && keylen != 48) {
+        SSLerr(SSL_F_SSL_CTX_ROTATE_TLSEXT_TICKET_KEY,
+               SSL_R_INVALID_TICKET_KEYS_LENGTH);
+        return 0;
+    }
+    if (!tls1_ticket_ring_push(ctx, keys, 0)) {
+        SSLerr(SSL_F_SSL_CTX_ROTATE_TLSEXT_TICKET_KEY, ERR_R_MALLOC_FAILURE);
+        return 0;
+    }
+    return 1;
+}
+
+int SSL_CTX_set_tlsext_ticket_key_ring_size(SSL_CTX *ctx, size_t num)
+{
+    if (!tls1_ticket_ring_set_max(ctx, num)) {
+        SSLerr(SSL_F_SSL_CTX_SET_TLSEXT_TICKET_KEY_RING_SIZE,
+               SSL_R_INVALID_TICKET_KEY_RING_SIZE);
+        return 0;
+    }
+    return 1;
+}
@@ -0,0 +1,223 @@
+/* ====================================================================
+ * Copyright (c) 2016 The OpenSSL Project.  All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * 3. All advertising materials mentioning features or use of this
+ *    software must display the following acknowledgment:
+ *    "This product includes software developed by the OpenSSL Project
+ *    for use in the OpenSSL Toolkit. (http://www.openssl.org/)"
+ *
+ * 4. The names "OpenSSL Toolkit" and "OpenSSL Project" must not be used to
+ *    endorse or promote products derived from this software without
+ *    prior written permission. For written permission, please contact
+ *    openssl-core@openssl.org.
+ *
+ * 5. Products derived from this software may not be called "OpenSSL"
+ *    nor may "OpenSSL" appear in their names without prior written
+ *    permission of the OpenSSL Project.
+ *
+ * 6. Redistributions of any form whatsoever must retain the following
+ *    acknowledgment:
+ *    "This product includes software developed by the OpenSSL Project
+ *    for use in the OpenSSL Toolkit (http://www.openssl.org/)"
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE OpenSSL PROJECT ``AS IS'' AND ANY
+ * EXPRESSED OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE OpenSSL PROJECT OR
+ * ITS CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT
+ * NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ * ====================================================================
+ *
+ * This product includes cryptographic software written by Eric Young
+ * (eay@cryptsoft.com).  This product includes software written by Tim
+ * Hudson (tjh@cryptsoft.com).
+ *
+ */
+
+/*
+ * Checks revoked entry lookups by serial number: hits and misses on a CRL
+ * built in memory, after entries are added once the lookup index exists,
+ * and on the same CRL after a signing and decoding round trip.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <openssl/asn1.h>
+#include <openssl/ec.h>
+#include <openssl/evp.h>
+#include <openssl/x509.h>
+#include <openssl/err.h>
+
+#define NUM_REVOKED     300
+
+static int add_revoked(X509_CRL *crl, long serial)
+{
+    X509_REVOKED *rev = X509_REVOKED_new();
+    ASN1_INTEGER *sn = ASN1_INTEGER_new();
+    ASN1_TIME *tm = X509_gmtime_adj(NULL, 0);
+    int ok = rev != NULL && sn != NULL && tm != NULL
+        && ASN1_INTEGER_set(sn, serial)
+        && X509_REVOKED_set_serialNumber(rev, sn)
+        && X509_REVOKED_set_revocationDate(rev, tm)
+        && X509_CRL_add0_revoked(crl, rev);
+
+    if (!ok)
+        X509_REVOKED_free(rev);
+    ASN1_INTEGER_free(sn);
+    ASN1_TIME_free(tm);
+    return ok;
+}
+
+/* Returns 1 if |serial| is found with the right entry, 0 if not, -1 on error */
+static int lookup(X509_CRL *crl, long serial)
+{
+    ASN1_INTEGER *sn = ASN1_INTEGER_new();
+    X509_REVOKED *rev = NULL;
+    int r;
+
+    if (sn == NULL || !ASN1_INTEGER_set(sn, serial)) {
+        ASN1_INTEGER_free(sn);
+        return -1;
+    }
+    r = X509_CRL_get0_by_serial(crl, &rev, sn);
+    if (r == 1 && ASN1_INTEGER_cmp(X509_REVOKED_get0_serialNumber(rev),
+                                   sn) != 0) {
+        fprintf(stderr, "serial %ld: wrong entry returned\n", serial);
+        r = -1;
+    }
+    ASN1_INTEGER_free(sn);
+    return r;
+}
+
+/* Even serials up to |max| are revoked, odd ones and anything larger not */
+static int check_lookups(X509_CRL *crl, long max, const char *what)
+{
+    long serial;
+    int ret = 1;
+
+    for (serial = 0; serial <= max + 16; serial++) {
+        int expect = serial > 0 && serial <= max && serial % 2 == 0;
+
+        if (lookup(crl, serial) != expect) {
+            fprintf(stderr, "%s: serial %ld %s\n", what, serial,
+                    expect ? "not found" : "unexpectedly found");
+            ret = 0;
+        }
+    }
+    return ret;
+}
+
+static EVP_PKEY *make_key(void)
+{
+    EVP_PKEY *pkey = EVP_PKEY_new();
+    EC_KEY *ec = EC_KEY_new_by_curve_name(NID_X9_62_prime256v1);
+
+    if (pkey == NULL || ec == NULL || !EC_KEY_generate_key(ec)
+        || !EVP_PKEY_assign_EC_KEY(pkey, ec)) {
+        EC_KEY_free(ec);
+        EVP_PKEY_free(pkey);
+        return NULL;
+    }
+    return pkey;
+}
+
+static int test_revoked_lookup(void)
+{
+    X509_CRL *crl = X509_CRL_new(), *crl2 = NULL;
+    X509_NAME *name = X509_NAME_new();
+    ASN1_TIME *tm = X509_gmtime_adj(NULL, 0);
+    EVP_PKEY *pkey = make_key();
+    unsigned char *der = NULL;
+    const unsigned char *p;
+    long serial;
+    int len, ret = 0;
+
+    if (crl == NULL || name == NULL || tm == NULL || pkey == NULL
+        || !X509_NAME_add_entry_by_txt(name, "CN", MBSTRING_ASC,
+                                       (unsigned char *)"CRL test", -1, -1, 0)
+        || !X509_CRL_set_issuer_name(crl, name)
+        || !X509_CRL_set_lastUpdate(crl, tm))
+        goto err;
+
+    /* An empty CRL revokes nothing */
+    if (!check_lookups(crl, 0, "empty"))
+        goto err;
+
+    /* Add in descending order so the stack is not already sorted */
+    for (serial = NUM_REVOKED; serial > 0; serial -= 2)
+        if (!add_revoked(crl, serial))
+            goto err;
+    if (!check_lookups(crl, NUM_REVOKED, "built"))
+        goto err;
+
+    /* Entries added after the first lookup must be found too */
+    for (serial = NUM_REVOKED + 2; serial <= NUM_REVOKED * 2; serial += 2)
+        if (!add_revoked(crl, serial))
+            goto err;
+    if (!check_lookups(crl, NUM_REVOKED * 2, "extended"))
+        goto err;
+
+    /* And the same after a round trip through DER */
+    if (!X509_CRL_sort(crl) || !X509_CRL_sign(crl, pkey, EVP_sha256())
+        || (len = i2d_X509_CRL(crl, &der)) <= 0)
+        goto err;
+    p = der;
+    if ((crl2 = d2i_X509_CRL(NULL, &p, len)) == NULL
+        || X509_CRL_verify(crl2, pkey) != 1)
+        goto err;
+    if (!check_lookups(crl2, NUM_REVOKED * 2, "decoded"))
+        goto err;
+
+    ret = 1;
+ err:
+    if (!ret)
+        ERR_print_errors_fp(stderr);
+    OPENSSL_free(der);
+    X509_CRL_free(crl2);
+    X509_CRL_free(crl);
+    X509_NAME_free(name);
+    ASN1_TIME_free(tm);
+    EVP_PKEY_free(pkey);
+    return ret;
+}
+
+int main(int argc, char **argv)
+{
+    int ret = EXIT_SUCCESS;
+
+    CRYPTO_set_mem_debug(1);
+    CRYPTO_mem_ctrl(CRYPTO_MEM_CHECK_ON);
+
+    ERR_load_crypto_strings();
+    OpenSSL_add_all_digests();
+
+    if (!test_revoked_lookup())
+        ret = EXIT_FAILURE;
+
+    EVP_cleanup();
+    CRYPTO_cleanup_all_ex_data();
+    ERR_remove_thread_state(NULL);
+    ERR_free_strings();
+#ifndef OPENSSL_NO_CRYPTO_MDEBUG
+    CRYPTO_mem_leaks_fp(stderr);
+#endif
+    return ret;
+}
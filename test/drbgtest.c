@@ -0,0 +1,169 @@
+/* ====================================================================
+ * Copyright (c) 2016 The OpenSSL Project.  All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * 3. All advertising materials mentioning features or use of this
+ *    software must display the following acknowledgment:
+ *    "This product includes software developed by the OpenSSL Project
+ *    for use in the OpenSSL Toolkit. (http://www.openssl.org/)"
+ *
+ * 4. The names "OpenSSL Toolkit" and "OpenSSL Project" must not be used to
+ *    endorse or promote products derived from this software without
+ *    prior written permission. For written permission, please contact
+ *    openssl-core@openssl.org.
+ *
+ * 5. Products derived from this software may not be called "OpenSSL"
+ *    nor may "OpenSSL" appear in their names without prior written
+ *    permission of the OpenSSL Project.
+ *
+ * 6. Redistributions of any form whatsoever must retain the following
+ *    acknowledgment:
+ *    "This product includes software developed by the OpenSSL Project
+ *    for use in the OpenSSL Toolkit (http://www.openssl.org/)"
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE OpenSSL PROJECT ``AS IS'' AND ANY
+ * EXPRESSED OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE OpenSSL PROJECT OR
+ * ITS CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT
+ * NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ * ====================================================================
+ *
+ * This product includes cryptographic software written by Eric Young
+ * (eay@cryptsoft.com).  This product includes software written by Tim
+ * Hudson (tjh@cryptsoft.com).
+ *
+ */
+
+/*
+ * Checks that the default RAND method's DRBGs reseed when they must: after
+ * their reseed interval, after RAND_seed() and RAND_add(), and in a forked
+ * child, which would otherwise repeat its parent's output.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <openssl/rand.h>
+#include <openssl/err.h>
+#include "../e_os.h"
+
+#if defined(OPENSSL_SYS_UNIX) && !defined(GETPID_IS_MEANINGLESS)
+# include <sys/types.h>
+# include <sys/wait.h>
+# include <unistd.h>
+# define DRBG_TEST_FORK
+#endif
+
+/* More requests than the child DRBG serves between reseeds */
+#define NUM_REQUESTS    ((1 << 16) + 1000)
+
+static int test_reseed_interval(void)
+{
+    unsigned char prev[16], buf[16];
+    int i;
+
+    if (RAND_bytes(prev, sizeof(prev)) <= 0)
+        return 0;
+    for (i = 0; i < NUM_REQUESTS; i++) {
+        if (RAND_bytes(buf, sizeof(buf)) <= 0) {
+            fprintf(stderr, "RAND_bytes failed at request %d\n", i);
+            return 0;
+        }
+        if (memcmp(buf, prev, sizeof(buf)) == 0) {
+            fprintf(stderr, "Output repeated at request %d\n", i);
+            return 0;
+        }
+        memcpy(prev, buf, sizeof(buf));
+    }
+    return 1;
+}
+
+static int test_reseed_add(void)
+{
+    unsigned char buf[32], seed[32];
+    int i;
+
+    memset(seed, 0x5a, sizeof(seed));
+    for (i = 0; i < 100; i++) {
+        if (i % 2)
+            RAND_seed(seed, sizeof(seed));
+        else
+            RAND_add(seed, sizeof(seed), 0.0);
+        if (RAND_bytes(buf, sizeof(buf)) <= 0) {
+            fprintf(stderr, "RAND_bytes failed after reseed %d\n", i);
+            return 0;
+        }
+    }
+    return 1;
+}
+
+#ifdef DRBG_TEST_FORK
+/* The parent and a forked child must not produce the same output */
+static int test_reseed_fork(void)
+{
+    unsigned char parent[32], child[32];
+    int fds[2], status, ret = 0;
+    pid_t pid;
+
+    /* Make sure this thread's DRBG exists before the fork */
+    if (RAND_bytes(parent, sizeof(parent)) <= 0 || pipe(fds) != 0)
+        return 0;
+    if ((pid = fork()) < 0) {
+        close(fds[0]);
+        close(fds[1]);
+        return 0;
+    }
+    if (pid == 0) {
+        close(fds[0]);
+        if (RAND_bytes(child, sizeof(child)) <= 0)
+            _exit(1);
+        _exit(write(fds[1], child, sizeof(child)) == sizeof(child) ? 0 : 1);
+    }
+    close(fds[1]);
+    if (RAND_bytes(parent, sizeof(parent)) > 0
+        && read(fds[0], child, sizeof(child)) == sizeof(child))
+        ret = 1;
+    close(fds[0]);
+    if (waitpid(pid, &status, 0) != pid || !WIFEXITED(status)
+        || WEXITSTATUS(status) != 0)
+        ret = 0;
+    if (ret && memcmp(parent, child, sizeof(parent)) == 0) {
+        fprintf(stderr, "Forked child repeated its parent's output\n");
+        ret = 0;
+    }
+    return ret;
+}
+#endif
+
+int main(int argc, char **argv)
+{
+    int ret = EXIT_SUCCESS;
+
+    if (!test_reseed_interval() || !test_reseed_add())
+        ret = EXIT_FAILURE;
+#ifdef DRBG_TEST_FORK
+    if (!test_reseed_fork())
+        ret = EXIT_FAILURE;
+#endif
+    if (ret != EXIT_SUCCESS)
+        ERR_print_errors_fp(stderr);
+    return ret;
+}
@@ -0,0 +1,229 @@
+/* ====================================================================
+ * Copyright (c) 2016 The OpenSSL Project.  All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * 3. All advertising materials mentioning features or use of this
+ *    software must display the following acknowledgment:
+ *    "This product includes software developed by the OpenSSL Project
+ *    for use in the OpenSSL Toolkit. (http://www.openssl.org/)"
+ *
+ * 4. The names "OpenSSL Toolkit" and "OpenSSL Project" must not be used to
+ *    endorse or promote products derived from this software without
+ *    prior written permission. For written permission, please contact
+ *    openssl-core@openssl.org.
+ *
+ * 5. Products derived from this software may not be called "OpenSSL"
+ *    nor may "OpenSSL" appear in their names without prior written
+ *    permission of the OpenSSL Project.
+ *
+ * 6. Redistributions of any form whatsoever must retain the following
+ *    acknowledgment:
+ *    "This product includes software developed by the OpenSSL Project
+ *    for use in the OpenSSL Toolkit (http://www.openssl.org/)"
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE OpenSSL PROJECT ``AS IS'' AND ANY
+ * EXPRESSED OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE OpenSSL PROJECT OR
+ * ITS CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT
+ * NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ * ====================================================================
+ *
+ * This product includes cryptographic software written by Eric Young
+ * (eay@cryptsoft.com).  This product includes software written by Tim
+ * Hudson (tjh@cryptsoft.com).
+ *
+ */
+
+/*
+ * Runs with CRYPTO_set_mem_cache() on and checks that freed blocks are
+ * reused for later allocations of the same size class, that realloc keeps
+ * the contents when a block changes class or grows beyond the largest one,
+ * and that the statistics add up.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <openssl/crypto.h>
+#include "../e_os.h"
+
+#define NUM_CLASSES     8
+#define MIN_CLASS_SIZE  16
+#define MANY            200
+
+typedef struct {
+    unsigned long allocs;
+    unsigned long hits;
+    unsigned long frees;
+} CLASS_STATS;
+
+static int get_stats(int cls, CLASS_STATS *st)
+{
+    return CRYPTO_get_mem_cache_stats(cls, NULL, &st->allocs, &st->hits,
+                                      &st->frees);
+}
+
+static int test_size_classes(void)
+{
+    size_t size;
+    int i;
+
+    for (i = 0; i < NUM_CLASSES; i++) {
+        if (!CRYPTO_get_mem_cache_stats(i, &size, NULL, NULL, NULL)
+            || size != (size_t)MIN_CLASS_SIZE << i) {
+            fprintf(stderr, "Size class %d is wrong\n", i);
+            return 0;
+        }
+    }
+    if (!CRYPTO_get_mem_cache_stats(NUM_CLASSES, &size, NULL, NULL, NULL)
+        || size != 0
+        || CRYPTO_get_mem_cache_stats(NUM_CLASSES + 1, NULL, NULL, NULL,
+                                      NULL)
+        || CRYPTO_get_mem_cache_stats(-1, NULL, NULL, NULL, NULL)) {
+        fprintf(stderr, "Unexpected size classes\n");
+        return 0;
+    }
+    return 1;
+}
+
+static int test_reuse(void)
+{
+    CLASS_STATS before, after;
+    void *p, *q;
+    int ret;
+
+    /* 100 and 120 bytes both fall in the 128 byte class */
+    if (!get_stats(3, &before) || (p = OPENSSL_malloc(100)) == NULL)
+        return 0;
+    OPENSSL_free(p);
+    if ((q = OPENSSL_malloc(120)) == NULL)
+        return 0;
+    ret = get_stats(3, &after)
+        && q == p
+        && after.allocs == before.allocs + 2
+        && after.hits == before.hits + 1
+        && after.frees == before.frees + 1;
+    OPENSSL_free(q);
+    if (!ret)
+        fprintf(stderr, "Freed block was not reused\n");
+    return ret;
+}
+
+static int test_many(void)
+{
+    CLASS_STATS before, after;
+    void *p[MANY];
+    int i, ret = 1;
+
+    for (i = 0; i < MANY; i++)
+        if ((p[i] = OPENSSL_malloc(40)) == NULL)
+            return 0;
+    for (i = 0; i < MANY; i++)
+        OPENSSL_free(p[i]);
+    if (!get_stats(2, &before))
+        return 0;
+    for (i = 0; i < MANY; i++) {
+        if ((p[i] = OPENSSL_malloc(40)) == NULL)
+            return 0;
+        memset(p[i], i, 40);
+    }
+    for (i = 0; i < MANY; i++) {
+        if (((unsigned char *)p[i])[39] != (unsigned char)i)
+            ret = 0;
+        OPENSSL_free(p[i]);
+    }
+    /* Only a bounded number of blocks is kept per thread */
+    if (!get_stats(2, &after)
+        || after.allocs != before.allocs + MANY
+        || after.frees != before.frees + MANY
+        || after.hits == before.hits
+        || after.hits - before.hits >= MANY)
+        ret = 0;
+    if (!ret)
+        fprintf(stderr, "Unexpected statistics for many blocks\n");
+    return ret;
+}
+
+static int check_fill(const unsigned char *p, size_t len)
+{
+    size_t i;
+
+    for (i = 0; i < len; i++)
+        if (p[i] != (unsigned char)i)
+            return 0;
+    return 1;
+}
+
+static int test_realloc(void)
+{
+    static const size_t sizes[] = { 10, 16, 700, 2048, 5000, 100000 };
+    CLASS_STATS before, after;
+    unsigned char *p = NULL, *q;
+    size_t i, j, len = 0;
+
+    if (!get_stats(NUM_CLASSES, &before))
+        return 0;
+    for (i = 0; i < OSSL_NELEM(sizes); i++) {
+        if ((q = OPENSSL_realloc(p, sizes[i])) == NULL) {
+            OPENSSL_free(p);
+            return 0;
+        }
+        p = q;
+        if (!check_fill(p, len)) {
+            fprintf(stderr, "realloc to %lu bytes lost the contents\n",
+                    (unsigned long)sizes[i]);
+            OPENSSL_free(p);
+            return 0;
+        }
+        for (j = len; j < sizes[i]; j++)
+            p[j] = (unsigned char)j;
+        len = sizes[i];
+    }
+    /* Shrinking keeps the block */
+    q = OPENSSL_realloc(p, 10);
+    if (q != p || !check_fill(q, 10)) {
+        fprintf(stderr, "Shrinking realloc moved the block\n");
+        OPENSSL_free(q != NULL ? q : p);
+        return 0;
+    }
+    OPENSSL_free(q);
+    if (!get_stats(NUM_CLASSES, &after) || after.allocs == before.allocs
+        || after.frees == before.frees) {
+        fprintf(stderr, "Large blocks were not counted\n");
+        return 0;
+    }
+    return 1;
+}
+
+int main(int argc, char **argv)
+{
+    int ret = EXIT_SUCCESS;
+
+    /* This must come before anything is allocated */
+    if (!CRYPTO_set_mem_cache(1)) {
+        fprintf(stderr, "Cannot turn on the allocation cache\n");
+        return EXIT_FAILURE;
+    }
+    if (!test_size_classes() || !test_reuse() || !test_many()
+        || !test_realloc())
+        ret = EXIT_FAILURE;
+    return ret;
+}
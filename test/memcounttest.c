@@ -0,0 +1,202 @@
+/* ====================================================================
+ * Copyright (c) 2016 The OpenSSL Project.  All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * 3. All advertising materials mentioning features or use of this
+ *    software must display the following acknowledgment:
+ *    "This product includes software developed by the OpenSSL Project
+ *    for use in the OpenSSL Toolkit. (http://www.openssl.org/)"
+ *
+ * 4. The names "OpenSSL Toolkit" and "OpenSSL Project" must not be used to
+ *    endorse or promote products derived from this software without
+ *    prior written permission. For written permission, please contact
+ *    openssl-core@openssl.org.
+ *
+ * 5. Products derived from this software may not be called "OpenSSL"
+ *    nor may "OpenSSL" appear in their names without prior written
+ *    permission of the OpenSSL Project.
+ *
+ * 6. Redistributions of any form whatsoever must retain the following
+ *    acknowledgment:
+ *    "This product includes software developed by the OpenSSL Project
+ *    for use in the OpenSSL Toolkit (http://www.openssl.org/)"
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE OpenSSL PROJECT ``AS IS'' AND ANY
+ * EXPRESSED OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE OpenSSL PROJECT OR
+ * ITS CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT
+ * NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ * ====================================================================
+ *
+ * This product includes cryptographic software written by Eric Young
+ * (eay@cryptsoft.com).  This product includes software written by Tim
+ * Hudson (tjh@cryptsoft.com).
+ *
+ */
+
+/*
+ * Checks the per-thread allocation counters of CRYPTO_set_mem_counters():
+ * that allocations, frees, reallocations and bytes are counted, that the
+ * peak follows the bytes in use, and what CRYPTO_reset_mem_counters() does.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <openssl/crypto.h>
+
+typedef struct {
+    unsigned long allocs;
+    unsigned long frees;
+    size_t bytes;
+    size_t peak;
+} COUNTERS;
+
+static int get_counters(COUNTERS *c)
+{
+    return CRYPTO_get_mem_counters(&c->allocs, &c->frees, &c->bytes,
+                                   &c->peak);
+}
+
+static int check_counters(const char *what, unsigned long allocs,
+                          unsigned long frees, size_t bytes, size_t peak)
+{
+    COUNTERS c;
+
+    if (!get_counters(&c)) {
+        fprintf(stderr, "%s: cannot get the counters\n", what);
+        return 0;
+    }
+    if (c.allocs != allocs || c.frees != frees || c.bytes != bytes
+        || c.peak != peak) {
+        fprintf(stderr,
+                "%s: got %lu/%lu/%lu/%lu, expected %lu/%lu/%lu/%lu\n", what,
+                c.allocs, c.frees, (unsigned long)c.bytes,
+                (unsigned long)c.peak, allocs, frees, (unsigned long)bytes,
+                (unsigned long)peak);
+        return 0;
+    }
+    return 1;
+}
+
+static int test_counts(void)
+{
+    COUNTERS start;
+    size_t live;
+    void *p, *q;
+    char *s;
+    int ret;
+
+    CRYPTO_reset_mem_counters();
+    if (!get_counters(&start))
+        return 0;
+    /* After a reset the peak is what the thread has in use */
+    live = start.peak;
+    if (!check_counters("reset", 0, 0, 0, live)
+        || (p = OPENSSL_malloc(100)) == NULL)
+        return 0;
+    if (!check_counters("malloc", 1, 0, 100, live + 100)
+        || (q = OPENSSL_zalloc(300)) == NULL) {
+        OPENSSL_free(p);
+        return 0;
+    }
+    OPENSSL_free(p);
+    ret = check_counters("zalloc and free", 2, 1, 400, live + 400);
+    OPENSSL_free(q);
+    if (!ret || !check_counters("free", 2, 2, 400, live + 400)
+        || (s = OPENSSL_strdup("counted")) == NULL)
+        return 0;
+    ret = check_counters("strdup", 3, 2, 408, live + 400);
+    OPENSSL_free(s);
+    return ret;
+}
+
+static int test_realloc(void)
+{
+    COUNTERS start;
+    size_t live;
+    void *p, *q;
+    int ret = 0;
+
+    CRYPTO_reset_mem_counters();
+    if (!get_counters(&start) || (p = OPENSSL_malloc(100)) == NULL)
+        return 0;
+    live = start.peak;
+    /* Growing counts as freeing the old block and allocating a new one */
+    if ((q = OPENSSL_realloc(p, 5000)) == NULL) {
+        OPENSSL_free(p);
+        return 0;
+    }
+    p = q;
+    if (!check_counters("realloc up", 2, 1, 5100, live + 5000))
+        goto err;
+    /* Shrinking keeps the block and counts nothing */
+    if ((q = OPENSSL_realloc(p, 10)) == NULL)
+        goto err;
+    p = q;
+    ret = check_counters("realloc down", 2, 1, 5100, live + 5000);
+ err:
+    OPENSSL_free(p);
+    return ret;
+}
+
+static int test_reset(void)
+{
+    COUNTERS start;
+    size_t live;
+    void *p, *q;
+    int ret = 0;
+
+    CRYPTO_reset_mem_counters();
+    if (!get_counters(&start) || (p = OPENSSL_malloc(1000)) == NULL)
+        return 0;
+    live = start.peak;
+    /* A block still in use at the reset keeps counting towards the peak */
+    CRYPTO_reset_mem_counters();
+    if (!check_counters("reset with a live block", 0, 0, 0, live + 1000)) {
+        OPENSSL_free(p);
+        return 0;
+    }
+    OPENSSL_free(p);
+    if ((q = OPENSSL_malloc(10)) == NULL)
+        return 0;
+    ret = check_counters("after reset", 1, 1, 10, live + 1000);
+    OPENSSL_free(q);
+    return ret;
+}
+
+int main(int argc, char **argv)
+{
+    int ret = EXIT_SUCCESS;
+
+    if (CRYPTO_get_mem_counters(NULL, NULL, NULL, NULL)) {
+        fprintf(stderr, "Counters reported before they were turned on\n");
+        return EXIT_FAILURE;
+    }
+    /* This must come before anything is allocated */
+    if (!CRYPTO_set_mem_counters(1)) {
+        fprintf(stderr, "Cannot turn on the allocation counters\n");
+        return EXIT_FAILURE;
+    }
+    if (!test_counts() || !test_realloc() || !test_reset())
+        ret = EXIT_FAILURE;
+    return ret;
+}
@@ -0,0 +1,378 @@
+/* ====================================================================
+ * Copyright (c) 2016 The OpenSSL Project.  All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * 3. All advertising materials mentioning features or use of this
+ *    software must display the following acknowledgment:
+ *    "This product includes software developed by the OpenSSL Project
+ *    for use in the OpenSSL Toolkit. (http://www.openssl.org/)"
+ *
+ * 4. The names "OpenSSL Toolkit" and "OpenSSL Project" must not be used to
+ *    endorse or promote products derived from this software without
+ *    prior written permission. For written permission, please contact
+ *    openssl-core@openssl.org.
+ *
+ * 5. Products derived from this software may not be called "OpenSSL"
+ *    nor may "OpenSSL" appear in their names without prior written
+ *    permission of the OpenSSL Project.
+ *
+ * 6. Redistributions of any form whatsoever must retain the following
+ *    acknowledgment:
+ *    "This product includes software developed by the OpenSSL Project
+ *    for use in the OpenSSL Toolkit (http://www.openssl.org/)"
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE OpenSSL PROJECT ``AS IS'' AND ANY
+ * EXPRESSED OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE OpenSSL PROJECT OR
+ * ITS CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT
+ * NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ * ====================================================================
+ *
+ * This product includes cryptographic software written by Eric Young
+ * (eay@cryptsoft.com).  This product includes software written by Tim
+ * Hudson (tjh@cryptsoft.com).
+ *
+ */
+
+/*
+ * Checks that every built in object can be found again by its short name,
+ * long name and encoding, and that lookups of unknown keys and of objects
+ * added at run time still work. Also checks OBJ_NAME lookups before and
+ * after OBJ_NAME_freeze() and across later changes, and that repeated
+ * changes and freezes do not keep old snapshots around.
+ *
+ * With "-bench count cert.pem..." it also times decoding the certificates
+ * (and caching their extensions) |count| times over, which is dominated by
+ * OID to NID lookups.
+ */
+
+#include <ctype.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <openssl/crypto.h>
+#include <openssl/objects.h>
+#include <openssl/evp.h>
+#include <openssl/asn1.h>
+#include <openssl/x509.h>
+#include <openssl/x509v3.h>
+#include <openssl/pem.h>
+#include <openssl/err.h>
+
+static int check_builtin(void)
+{
+    int nid, num = OBJ_new_nid(0), found = 0, ret = 1;
+
+    for (nid = 1; nid < num; nid++) {
+        const ASN1_OBJECT *obj;
+        ASN1_OBJECT *copy;
+        const char *sn, *ln;
+        int n;
+
+        if ((obj = OBJ_nid2obj(nid)) == NULL)
+            continue;
+        found++;
+        sn = OBJ_nid2sn(nid);
+        ln = OBJ_nid2ln(nid);
+
+        /* A few names and OIDs are shared, so compare keys, not NIDs */
+        n = OBJ_sn2nid(sn);
+        if (n == NID_undef || strcmp(OBJ_nid2sn(n), sn) != 0) {
+            fprintf(stderr, "sn2nid(\"%s\") = %d, expected %d\n", sn, n, nid);
+            ret = 0;
+        }
+        n = OBJ_ln2nid(ln);
+        if (n == NID_undef || strcmp(OBJ_nid2ln(n), ln) != 0) {
+            fprintf(stderr, "ln2nid(\"%s\") = %d, expected %d\n", ln, n, nid);
+            ret = 0;
+        }
+        if (OBJ_length(obj) == 0)
+            continue;
+        /* A copy without the cached NID, as a decoder would look it up */
+        copy = ASN1_OBJECT_create(NID_undef,
+                                  (unsigned char *)OBJ_get0_data(obj),
+                                  OBJ_length(obj), NULL, NULL);
+        n = OBJ_obj2nid(copy);
+        if (n == NID_undef || OBJ_cmp(OBJ_nid2obj(n), obj) != 0) {
+            fprintf(stderr, "obj2nid(%s) = %d, expected %d\n", sn, n, nid);
+            ret = 0;
+        }
+        ASN1_OBJECT_free(copy);
+    }
+    ERR_clear_error();
+    if (found < 900) {
+        fprintf(stderr, "only %d built in objects\n", found);
+        ret = 0;
+    }
+    return ret;
+}
+
+static int check_unknown(void)
+{
+    static const char *names[] = {
+        "", "cn", "CN ", "commonname", "sha256WithRSAEncryptio", "1.2.3.4.99"
+    };
+    static const unsigned char der[] = { 0x55, 0x04, 0x7f };
+    ASN1_OBJECT *obj;
+    size_t i;
+    int ret = 1;
+
+    for (i = 0; i < sizeof(names) / sizeof(names[0]); i++) {
+        if (OBJ_sn2nid(names[i]) != NID_undef
+            || OBJ_ln2nid(names[i]) != NID_undef) {
+            fprintf(stderr, "\"%s\" found\n", names[i]);
+            ret = 0;
+        }
+    }
+    obj = ASN1_OBJECT_create(NID_undef, (unsigned char *)der, sizeof(der),
+                             NULL, NULL);
+    if (OBJ_obj2nid(obj) != NID_undef) {
+        fprintf(stderr, "unknown OID found\n");
+        ret = 0;
+    }
+    ASN1_OBJECT_free(obj);
+    return ret;
+}
+
+static int check_added(void)
+{
+    int nid = OBJ_create("1.2.3.4.99", "testSN", "test long name");
+
+    if (nid == NID_undef
+        || OBJ_sn2nid("testSN") != nid
+        || OBJ_ln2nid("test long name") != nid
+        || OBJ_txt2nid("1.2.3.4.99") != nid
+        || OBJ_txt2nid("CN") != NID_commonName
+        || OBJ_txt2nid("2.5.4.3") != NID_commonName) {
+        fprintf(stderr, "added object not found\n");
+        return 0;
+    }
+    return 1;
+}
+
+static int check_name(int type, const char *name, const char *expected)
+{
+    const char *data = OBJ_NAME_get(name, type);
+
+    if (expected == NULL ? data == NULL
+        : data != NULL && strcmp(data, expected) == 0)
+        return 1;
+    fprintf(stderr, "OBJ_NAME_get(\"%s\", %d) = \"%s\", expected \"%s\"\n",
+            name, type, data == NULL ? "(null)" : data,
+            expected == NULL ? "(null)" : expected);
+    return 0;
+}
+
+/* The data of digest and cipher names is the method, not a string */
+static int check_builtin_names(void)
+{
+    if (OBJ_NAME_get("SHA256", OBJ_NAME_TYPE_MD_METH)
+            != (const char *)EVP_sha256()
+        || OBJ_NAME_get("sha256", OBJ_NAME_TYPE_MD_METH)
+            != (const char *)EVP_sha256()
+        || OBJ_NAME_get("AES256", OBJ_NAME_TYPE_CIPHER_METH)
+            != (const char *)EVP_aes_256_cbc()
+        || OBJ_NAME_get("SHA257", OBJ_NAME_TYPE_MD_METH) != NULL
+        || OBJ_NAME_get("SHA256", OBJ_NAME_TYPE_CIPHER_METH) != NULL) {
+        fprintf(stderr, "built in names not found\n");
+        return 0;
+    }
+    return check_name(OBJ_NAME_TYPE_CIPHER_METH | OBJ_NAME_ALIAS, "AES256",
+                      SN_aes_256_cbc);
+}
+
+static unsigned long name_case_hash(const char *name)
+{
+    unsigned long ret = 0;
+
+    while (*name != '\0')
+        ret = ret * 31 + tolower((unsigned char)*name++);
+    return ret;
+}
+
+static int name_case_cmp(const char *a, const char *b)
+{
+    while (*a != '\0' && tolower((unsigned char)*a)
+                          == tolower((unsigned char)*b)) {
+        a++;
+        b++;
+    }
+    return tolower((unsigned char)*a) - tolower((unsigned char)*b);
+}
+
+static int check_names(void)
+{
+    int type = OBJ_NAME_new_index(NULL, NULL, NULL), ci_type;
+    int ret = 1;
+
+    /* The built in names, frozen by OpenSSL_add_all_algorithms() */
+    if (!check_builtin_names())
+        return 0;
+
+    if (type == 0
+        || !OBJ_NAME_add("objtest-one", type, "1")
+        || !OBJ_NAME_add("objtest-alias", type | OBJ_NAME_ALIAS,
+                         "objtest-one"))
+        return 0;
+    /* Before, after and again after freezing */
+    ret &= check_name(type, "objtest-alias", "1");
+    ret &= OBJ_NAME_freeze();
+    ret &= check_name(type, "objtest-alias", "1");
+    ret &= check_name(type | OBJ_NAME_ALIAS, "objtest-alias", "objtest-one");
+    ret &= check_name(type, "objtest-two", NULL);
+    ret &= OBJ_NAME_freeze();
+    ret &= check_name(type, "objtest-one", "1");
+
+    /* Changes after a freeze must be seen */
+    ret &= OBJ_NAME_add("objtest-two", type, "2");
+    ret &= check_name(type, "objtest-two", "2");
+    ret &= OBJ_NAME_freeze();
+    ret &= check_name(type, "objtest-two", "2");
+    ret &= OBJ_NAME_add("objtest-two", type, "2b");
+    ret &= check_name(type, "objtest-two", "2b");
+    ret &= OBJ_NAME_freeze();
+    ret &= OBJ_NAME_remove("objtest-one", type);
+    ret &= check_name(type, "objtest-one", NULL);
+    ret &= check_name(type, "objtest-alias", NULL);
+    ret &= OBJ_NAME_freeze();
+    ret &= check_name(type, "objtest-alias", NULL);
+    ret &= check_name(type, "objtest-two", "2b");
+
+    /* A new type with its own functions, after a freeze */
+    ci_type = OBJ_NAME_new_index(name_case_hash, name_case_cmp, NULL);
+    ret &= check_builtin_names();
+    ret &= OBJ_NAME_add("ObjTest-Case", ci_type, "case");
+    ret &= OBJ_NAME_freeze();
+    ret &= check_name(ci_type, "OBJTEST-case", "case");
+    ret &= check_name(type, "OBJTEST-two", NULL);
+    ret &= check_builtin_names();
+
+    OBJ_NAME_cleanup(type);
+    OBJ_NAME_cleanup(ci_type);
+    ret &= check_name(type, "objtest-two", NULL);
+    ret &= check_builtin_names();
+    return ret;
+}
+
+/*
+ * Changing the names and freezing them again, over and over, should not
+ * leave old snapshots behind. Measured with the allocation counters: after
+ * CRYPTO_reset_mem_counters() the peak is the number of bytes in use.
+ */
+static int check_name_snapshots(void)
+{
+    size_t before, after;
+    int type = OBJ_NAME_new_index(NULL, NULL, NULL), i, ret = 1;
+
+    for (i = 0; i < 210 && ret; i++) {
+        if (i == 10) {
+            CRYPTO_reset_mem_counters();
+            if (!CRYPTO_get_mem_counters(NULL, NULL, NULL, &before))
+                return 0;
+        }
+        ret = OBJ_NAME_add("objtest-cycle", type, "cycle")
+              && OBJ_NAME_freeze()
+              && check_name(type, "objtest-cycle", "cycle")
+              && OBJ_NAME_remove("objtest-cycle", type);
+    }
+    CRYPTO_reset_mem_counters();
+    if (!ret || !CRYPTO_get_mem_counters(NULL, NULL, NULL, &after))
+        return 0;
+    if (after > before) {
+        fprintf(stderr, "%lu bytes more in use after 200 freezes\n",
+                (unsigned long)(after - before));
+        return 0;
+    }
+    return OBJ_NAME_freeze();
+}
+
+static int bench(int count, int argc, char **argv)
+{
+    STACK_OF(X509) *certs = sk_X509_new_null();
+    unsigned char **der = NULL;
+    int *len = NULL;
+    int i, n, ret = 0;
+    clock_t start;
+    X509 *x;
+
+    for (i = 0; i < argc; i++) {
+        BIO *in = BIO_new_file(argv[i], "r");
+
+        if (in == NULL)
+            goto err;
+        while ((x = PEM_read_bio_X509(in, NULL, NULL, NULL)) != NULL)
+            sk_X509_push(certs, x);
+        BIO_free(in);
+    }
+    ERR_clear_error();
+    n = sk_X509_num(certs);
+    der = OPENSSL_zalloc(sizeof(*der) * (n + 1));
+    len = OPENSSL_zalloc(sizeof(*len) * (n + 1));
+    if (n == 0 || der == NULL || len == NULL)
+        goto err;
+    for (i = 0; i < n; i++)
+        len[i] = i2d_X509(sk_X509_value(certs, i), &der[i]);
+
+    start = clock();
+    while (count-- > 0) {
+        for (i = 0; i < n; i++) {
+            const unsigned char *p = der[i];
+
+            x = d2i_X509(NULL, &p, len[i]);
+            if (x == NULL)
+                goto err;
+            X509_check_purpose(x, -1, 0);
+            X509_free(x);
+        }
+    }
+    printf("%d certificates: %.2fs\n", n,
+           (double)(clock() - start) / CLOCKS_PER_SEC);
+    ret = 1;
+ err:
+    for (i = 0; der != NULL && der[i] != NULL; i++)
+        OPENSSL_free(der[i]);
+    OPENSSL_free(der);
+    OPENSSL_free(len);
+    sk_X509_pop_free(certs, X509_free);
+    return ret;
+}
+
+int main(int argc, char **argv)
+{
+    int ret = EXIT_SUCCESS;
+
+    /* This must come before anything is allocated */
+    CRYPTO_set_mem_counters(1);
+    OpenSSL_add_all_algorithms();
+
+    if (!check_builtin() || !check_unknown() || !check_added()
+        || !check_names() || !check_name_snapshots())
+        ret = EXIT_FAILURE;
+    if (ret == EXIT_SUCCESS && argc > 2 && strcmp(argv[1], "-bench") == 0
+        && !bench(atoi(argv[2]), argc - 3, argv + 3)) {
+        ERR_print_errors_fp(stderr);
+        ret = EXIT_FAILURE;
+    }
+    EVP_cleanup();
+    OBJ_cleanup();
+    return ret;
+}
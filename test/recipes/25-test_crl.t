@@ -8,10 +8,12 @@ use OpenSSL::Test qw/:DEFAULT top_file/;
 
 setup("test_crl");
 
-plan tests => 2;
+plan tests => 3;
 
 require_ok(top_file('test','recipes','tconversion.pl'));
 
 subtest 'crl conversions' => sub {
     tconversion("crl", top_file("test","testcrl.pem"));
 };
+
+ok(run(test(["crltest"])));
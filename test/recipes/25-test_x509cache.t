@@ -0,0 +1,9 @@
+#! /usr/bin/perl
+
+use OpenSSL::Test qw/:DEFAULT top_file/;
+
+setup("test_x509cache");
+
+plan tests => 1;
+
+ok(run(test(["x509cachetest", top_file("test", "certs", "untrusted.pem")])));
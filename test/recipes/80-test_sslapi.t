@@ -0,0 +1,9 @@
+#! /usr/bin/perl
+
+use OpenSSL::Test qw/:DEFAULT top_dir/;
+
+setup("test_sslapi");
+
+plan tests => 1;
+
+ok(run(test(["sslapitest", top_dir("test", "certs")])));
@@ -0,0 +1,39 @@
+#! /usr/bin/perl
+
+use strict;
+use warnings;
+
+use OpenSSL::Test qw/:DEFAULT top_file/;
+use OpenSSL::Test::Utils;
+
+setup("test_memcache");
+
+my $no_dtls1_2 = disabled("dtls1_2");
+
+plan tests => 6;
+
+ok(run(test(["memcachetest"])), "running memcachetest");
+
+# Everything below runs with the per-thread allocation cache on
+$ENV{OPENSSL_MEM_CACHE} = "on";
+
+my $server = top_file("apps", "server.pem");
+my @ssltest = ("ssltest",
+               "-s_key", $server, "-s_cert", $server,
+               "-c_key", $server, "-c_cert", $server);
+
+ok(run(app(["openssl", "x509", "-in", $server, "-noout", "-text"])),
+   "openssl x509 with the allocation cache");
+ok(run(test([@ssltest])),
+   "ssltest with the allocation cache");
+ok(run(test([@ssltest, "-bio_pair", "-reuse", "-num", "10"])),
+   "ssltest with session reuse and the allocation cache");
+ok(run(test([@ssltest, "-bio_pair", "-bytes", "1000000"])),
+   "ssltest bulk data with the allocation cache");
+
+SKIP: {
+    skip "DTLSv1.2 is not supported by this OpenSSL build", 1
+        if $no_dtls1_2;
+    ok(run(test([@ssltest, "-dtls12", "-num", "10"])),
+       "DTLS ssltest with the allocation cache");
+}
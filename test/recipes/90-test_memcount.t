@@ -0,0 +1,30 @@
+#! /usr/bin/perl
+
+use strict;
+use warnings;
+
+use OpenSSL::Test qw/:DEFAULT top_file/;
+
+setup("test_memcount");
+
+plan tests => 3;
+
+ok(run(test(["memcounttest"])), "running memcounttest");
+
+my $server = top_file("apps", "server.pem");
+my @ssltest = ("ssltest", "-allocs", "-reuse", "-num", "5",
+               "-s_key", $server, "-s_cert", $server,
+               "-c_key", $server, "-c_cert", $server);
+
+# Once a connection is up, sending and receiving records should not
+# allocate at all
+my @out = run(test([@ssltest]), capture => 1);
+ok(grep(/^per record: 0 allocations, 0 frees/, @out),
+   "no allocations per record");
+
+{
+    local $ENV{OPENSSL_MEM_CACHE} = "on";
+    @out = run(test([@ssltest]), capture => 1);
+    ok(grep(/^per record: 0 allocations, 0 frees/, @out),
+       "no allocations per record with the allocation cache");
+}
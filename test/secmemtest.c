@@ -1,6 +1,68 @@
 
+#include <stdio.h>
+#include <string.h>
 #include <openssl/crypto.h>
 
+#if defined(OPENSSL_THREADS) \
+    && (defined(OPENSSL_SYS_LINUX) || defined(OPENSSL_SYS_UNIX))
+# include <pthread.h>
+# include <sys/time.h>
+
+# define ITERATIONS      100000
+# define MAX_THREADS     4
+
+static const size_t sizes[] = { 20, 64, 200, 512 };
+static volatile int thread_failed = 0;
+
+/* Allocate and free a few typical BIGNUM-sized chunks, over and over */
+static void *alloc_free_loop(void *arg)
+{
+    void *p[sizeof(sizes) / sizeof(sizes[0])];
+    size_t j;
+    int i;
+
+    for (i = 0; i < ITERATIONS; i++) {
+        for (j = 0; j < sizeof(p) / sizeof(p[0]); j++) {
+            p[j] = OPENSSL_secure_malloc(sizes[j]);
+            if (!CRYPTO_secure_allocated(p[j])
+                    || CRYPTO_secure_actual_size(p[j]) < sizes[j]) {
+                thread_failed = 1;
+                return NULL;
+            }
+            memset(p[j], 0xff, sizes[j]);
+        }
+        for (j = 0; j < sizeof(p) / sizeof(p[0]); j++)
+            OPENSSL_secure_free(p[j]);
+    }
+    return NULL;
+}
+
+/* Time |n| threads running alloc_free_loop() at once */
+static int run_threads(int n)
+{
+    pthread_t t[MAX_THREADS];
+    struct timeval start, end;
+    double secs;
+    int i;
+
+    gettimeofday(&start, NULL);
+    for (i = 0; i < n; i++)
+        if (pthread_create(&t[i], NULL, alloc_free_loop, NULL) != 0)
+            return 0;
+    for (i = 0; i < n; i++)
+        pthread_join(t[i], NULL);
+    gettimeofday(&end, NULL);
+    if (thread_failed)
+        return 0;
+
+    secs = (end.tv_sec - start.tv_sec) + (end.tv_usec - start.tv_usec) / 1e6;
+    printf("%d thread%s: %.0f secure alloc/free pairs per second\n",
+           n, n == 1 ? "" : "s",
+           n * ITERATIONS * (sizeof(sizes) / sizeof(sizes[0])) / secs);
+    return 1;
+}
+#endif
+
 int main(int argc, char **argv)
 {
 #if defined(OPENSSL_SYS_LINUX) || defined(OPENSSL_SYS_UNIX)
@@ -23,6 +85,28 @@ int main(int argc, char **argv)
     CRYPTO_secure_free(p);
     CRYPTO_free(q);
     CRYPTO_secure_malloc_done();
+# ifdef OPENSSL_THREADS
+    {
+        int n;
+
+        if (!CRYPTO_secure_malloc_init(65536, 16)) {
+            perror("failed 2");
+            return 1;
+        }
+        for (n = 1; n <= MAX_THREADS; n *= 2) {
+            if (!run_threads(n)) {
+                fprintf(stderr, "failed with %d threads\n", n);
+                return 1;
+            }
+        }
+        if (CRYPTO_secure_used() != 0) {
+            fprintf(stderr, "failed: %lu bytes still in use\n",
+                    (unsigned long)CRYPTO_secure_used());
+            return 1;
+        }
+        CRYPTO_secure_malloc_done();
+    }
+# endif
 #else
     /* Should fail. */
     if (CRYPTO_secure_malloc_init(4096, 32)) {
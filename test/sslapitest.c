@@ -0,0 +1,1626 @@
+/* ====================================================================
+ * Copyright (c) 2016 The OpenSSL Project.  All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * 3. All advertising materials mentioning features or use of this
+ *    software must display the following acknowledgment:
+ *    "This product includes software developed by the OpenSSL Project
+ *    for use in the OpenSSL Toolkit. (http://www.openssl.org/)"
+ *
+ * 4. The names "OpenSSL Toolkit" and "OpenSSL Project" must not be used to
+ *    endorse or promote products derived from this software without
+ *    prior written permission. For written permission, please contact
+ *    openssl-core@openssl.org.
+ *
+ * 5. Products derived from this software may not be called "OpenSSL"
+ *    nor may "OpenSSL" appear in their names without prior written
+ *    permission of the OpenSSL Project.
+ *
+ * 6. Redistributions of any form whatsoever must retain the following
+ *    acknowledgment:
+ *    "This product includes software developed by the OpenSSL Project
+ *    for use in the OpenSSL Toolkit (http://www.openssl.org/)"
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE OpenSSL PROJECT ``AS IS'' AND ANY
+ * EXPRESSED OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE OpenSSL PROJECT OR
+ * ITS CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT
+ * NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ * ====================================================================
+ *
+ * This product includes cryptographic software written by Eric Young
+ * (eay@cryptsoft.com).  This product includes software written by Tim
+ * Hudson (tjh@cryptsoft.com).
+ *
+ */
+
+/*
+ * Tests of the libssl API that need a server and a client: each test sets
+ * up its own SSL_CTXs and connects them over a BIO pair.
+ *
+ * Usage: sslapitest certsdir, with the certificates from test/certs.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <openssl/crypto.h>
+#include <openssl/bio.h>
+#include <openssl/ssl.h>
+#include <openssl/ocsp.h>
+#include <openssl/pem.h>
+#include <openssl/err.h>
+#include <openssl/async.h>
+#ifndef OPENSSL_NO_ENGINE
+#include <openssl/engine.h>
+#endif
+#include "internal/ktls.h"
+#include "testutil.h"
+
+static const char *certsdir = NULL;
+
+static X509 *load_cert(const char *name)
+{
+    char path[1024];
+    BIO *bio;
+    X509 *x = NULL;
+
+    BIO_snprintf(path, sizeof(path), "%s/%s", certsdir, name);
+    if ((bio = BIO_new_file(path, "r")) != NULL)
+        x = PEM_read_bio_X509(bio, NULL, NULL, NULL);
+    BIO_free(bio);
+    if (x == NULL)
+        fprintf(stderr, "Cannot load certificate %s\n", path);
+    return x;
+}
+
+static EVP_PKEY *load_key(const char *name)
+{
+    char path[1024];
+    BIO *bio;
+    EVP_PKEY *pkey = NULL;
+
+    BIO_snprintf(path, sizeof(path), "%s/%s", certsdir, name);
+    if ((bio = BIO_new_file(path, "r")) != NULL)
+        pkey = PEM_read_bio_PrivateKey(bio, NULL, NULL, NULL);
+    BIO_free(bio);
+    if (pkey == NULL)
+        fprintf(stderr, "Cannot load key %s\n", path);
+    return pkey;
+}
+
+/* A server SSL_CTX with ee-cert.pem and a client SSL_CTX */
+static int create_ssl_ctxs(SSL_CTX **sctx, SSL_CTX **cctx)
+{
+    X509 *x = load_cert("ee-cert.pem");
+    EVP_PKEY *pkey = load_key("ee-key.pem");
+    int ret = 0;
+
+    *sctx = SSL_CTX_new(TLS_server_method());
+    *cctx = SSL_CTX_new(TLS_client_method());
+    if (x != NULL && pkey != NULL && *sctx != NULL && *cctx != NULL
+        && SSL_CTX_use_certificate(*sctx, x)
+        && SSL_CTX_use_PrivateKey(*sctx, pkey))
+        ret = 1;
+    X509_free(x);
+    EVP_PKEY_free(pkey);
+    if (!ret) {
+        SSL_CTX_free(*sctx);
+        SSL_CTX_free(*cctx);
+        *sctx = *cctx = NULL;
+    }
+    return ret;
+}
+
+/*
+ * New server and client SSL objects connected through a BIO pair holding
+ * |bufsize| bytes each way, or the default if 0
+ */
+static int create_ssl_objects_bufsize(SSL_CTX *sctx, SSL_CTX *cctx,
+                                      SSL **sssl, SSL **cssl, size_t bufsize)
+{
+    BIO *s_bio = NULL, *c_bio = NULL;
+
+    *sssl = SSL_new(sctx);
+    *cssl = SSL_new(cctx);
+    if (*sssl == NULL || *cssl == NULL
+        || !BIO_new_bio_pair(&s_bio, bufsize, &c_bio, bufsize)) {
+        SSL_free(*sssl);
+        SSL_free(*cssl);
+        *sssl = *cssl = NULL;
+        return 0;
+    }
+    SSL_set_bio(*sssl, s_bio, s_bio);
+    SSL_set_bio(*cssl, c_bio, c_bio);
+    SSL_set_accept_state(*sssl);
+    SSL_set_connect_state(*cssl);
+    return 1;
+}
+
+static int create_ssl_objects(SSL_CTX *sctx, SSL_CTX *cctx, SSL **sssl,
+                              SSL **cssl)
+{
+    return create_ssl_objects_bufsize(sctx, cctx, sssl, cssl, 0);
+}
+
+/* Drive both sides until the handshake is complete or fails */
+static int create_ssl_connection(SSL *sssl, SSL *cssl)
+{
+    int i, rets = 0, retc = 0;
+
+    for (i = 0; i < 100 && (rets <= 0 || retc <= 0); i++) {
+        if (retc <= 0) {
+            retc = SSL_do_handshake(cssl);
+            if (retc <= 0 && SSL_get_error(cssl, retc) != SSL_ERROR_WANT_READ)
+                break;
+        }
+        if (rets <= 0) {
+            rets = SSL_do_handshake(sssl);
+            if (rets <= 0 && SSL_get_error(sssl, rets) != SSL_ERROR_WANT_READ)
+                break;
+        }
+    }
+    if (rets <= 0 || retc <= 0) {
+        fprintf(stderr, "Handshake failed\n");
+        ERR_print_errors_fp(stderr);
+        return 0;
+    }
+    return 1;
+}
+
+/*
+ * The OCSP staple cache: a client that asks for certificate status gets the
+ * cached response, an expired one is not sent, and the refresh callback is
+ * called once per response when it is due.
+ */
+
+/* An OCSP response from ca-cert.pem saying |ee| is good until |nextupd| */
+static int make_ocsp_resp(X509 *ee, long nextupd, unsigned char **der)
+{
+    X509 *ca = load_cert("ca-cert.pem");
+    EVP_PKEY *cakey = load_key("ca-key.pem");
+    OCSP_BASICRESP *bs = OCSP_BASICRESP_new();
+    OCSP_RESPONSE *rsp = NULL;
+    OCSP_CERTID *id = NULL;
+    ASN1_TIME *thisupd = X509_gmtime_adj(NULL, -3600);
+    ASN1_TIME *next = X509_gmtime_adj(NULL, nextupd);
+    int len = 0;
+
+    *der = NULL;
+    if (ca != NULL && cakey != NULL && bs != NULL && thisupd != NULL
+        && next != NULL
+        && (id = OCSP_cert_to_id(NULL, ee, ca)) != NULL
+        && OCSP_basic_add1_status(bs, id, V_OCSP_CERTSTATUS_GOOD, 0, NULL,
+                                  thisupd, next) != NULL
+        && OCSP_basic_sign(bs, ca, cakey, EVP_sha256(), NULL, 0)
+        && (rsp = OCSP_response_create(OCSP_RESPONSE_STATUS_SUCCESSFUL,
+                                       bs)) != NULL)
+        len = i2d_OCSP_RESPONSE(rsp, der);
+    OCSP_RESPONSE_free(rsp);
+    OCSP_CERTID_free(id);
+    OCSP_BASICRESP_free(bs);
+    ASN1_TIME_free(thisupd);
+    ASN1_TIME_free(next);
+    EVP_PKEY_free(cakey);
+    X509_free(ca);
+    return len;
+}
+
+typedef struct {
+    unsigned char *resp;
+    long resplen;
+} OCSP_SEEN;
+
+static int ocsp_client_cb(SSL *s, void *arg)
+{
+    OCSP_SEEN *seen = arg;
+    const unsigned char *resp;
+
+    OPENSSL_free(seen->resp);
+    seen->resp = NULL;
+    seen->resplen = SSL_get_tlsext_status_ocsp_resp(s, &resp);
+    if (seen->resplen > 0)
+        seen->resp = OPENSSL_memdup(resp, seen->resplen);
+    return 1;
+}
+
+static int refresh_calls = 0;
+
+static void ocsp_refresh_cb(SSL_CTX *ctx, X509 *x, void *arg)
+{
+    refresh_calls++;
+}
+
+/* Connect and check the client got |resp|, or no response if NULL */
+static int ocsp_handshake(SSL_CTX *sctx, SSL_CTX *cctx, OCSP_SEEN *seen,
+                          const unsigned char *resp, int resplen)
+{
+    SSL *sssl = NULL, *cssl = NULL;
+    int ret = 0;
+
+    OPENSSL_free(seen->resp);
+    seen->resp = NULL;
+    seen->resplen = -2;
+    if (!create_ssl_objects(sctx, cctx, &sssl, &cssl))
+        goto end;
+    SSL_set_tlsext_status_type(cssl, TLSEXT_STATUSTYPE_ocsp);
+    if (!create_ssl_connection(sssl, cssl))
+        goto end;
+    if (resp == NULL ? seen->resplen > 0
+        : seen->resplen != resplen || memcmp(seen->resp, resp, resplen) != 0) {
+        fprintf(stderr, "Unexpected OCSP response of length %ld\n",
+                seen->resplen);
+        goto end;
+    }
+    ret = 1;
+ end:
+    SSL_free(sssl);
+    SSL_free(cssl);
+    return ret;
+}
+
+static int test_ocsp_staple_cache(void)
+{
+    SSL_CTX *sctx = NULL, *cctx = NULL;
+    X509 *ee = NULL, *ca = NULL;
+    unsigned char *fresh = NULL, *expired = NULL;
+    int freshlen, expiredlen, testresult = 1;
+    OCSP_SEEN seen = { NULL, -2 };
+
+    refresh_calls = 0;
+    if (!create_ssl_ctxs(&sctx, &cctx)
+        || (ee = load_cert("ee-cert.pem")) == NULL
+        || (ca = load_cert("ca-cert.pem")) == NULL
+        || !X509_STORE_add_cert(SSL_CTX_get_cert_store(sctx), ca))
+        goto end;
+    SSL_CTX_set_ocsp_staple_refresh_cb(sctx, ocsp_refresh_cb, NULL);
+    SSL_CTX_set_tlsext_status_cb(cctx, ocsp_client_cb);
+    SSL_CTX_set_tlsext_status_arg(cctx, &seen);
+
+    /* Valid for two days, and one that expired within the allowed skew */
+    freshlen = make_ocsp_resp(ee, 2 * 24 * 3600, &fresh);
+    expiredlen = make_ocsp_resp(ee, -100, &expired);
+    if (freshlen <= 0 || expiredlen <= 0)
+        goto end;
+
+    /* Nothing cached yet */
+    if (!ocsp_handshake(sctx, cctx, &seen, NULL, 0))
+        goto end;
+
+    /*
+     * An expired response is not sent. Its refresh is overdue, but the
+     * application is only asked once.
+     */
+    if (!SSL_CTX_set1_ocsp_staple(sctx, NULL, expired, expiredlen)
+        || !ocsp_handshake(sctx, cctx, &seen, NULL, 0)
+        || !ocsp_handshake(sctx, cctx, &seen, NULL, 0))
+        goto end;
+    if (refresh_calls != 1) {
+        fprintf(stderr, "Refresh callback called %d times\n", refresh_calls);
+        goto end;
+    }
+
+    /*
+     * The new response replaces the old one. It is given for a different
+     * copy of the certificate, so the lookup must compare certificates.
+     */
+    if (!SSL_CTX_set1_ocsp_staple(sctx, ee, fresh, freshlen)
+        || !ocsp_handshake(sctx, cctx, &seen, fresh, freshlen)
+        || !ocsp_handshake(sctx, cctx, &seen, fresh, freshlen))
+        goto end;
+    if (refresh_calls != 1) {
+        fprintf(stderr, "Refresh callback called %d times\n", refresh_calls);
+        goto end;
+    }
+
+    /* A response for the wrong certificate is rejected */
+    if (SSL_CTX_set1_ocsp_staple(sctx, ca, fresh, freshlen)) {
+        fprintf(stderr, "Response accepted for the wrong certificate\n");
+        goto end;
+    }
+    ERR_clear_error();
+
+    testresult = 0;
+ end:
+    OPENSSL_free(seen.resp);
+    OPENSSL_free(fresh);
+    OPENSSL_free(expired);
+    X509_free(ee);
+    X509_free(ca);
+    SSL_CTX_free(sctx);
+    SSL_CTX_free(cctx);
+    return testresult;
+}
+
+/*
+ * An SSL shares its SSL_CTX's certificates and settings until one of them
+ * changes them: changes on either side must not reach the other.
+ */
+
+static int cert_cb_calls = 0;
+
+static int count_cert_cb(SSL *s, void *arg)
+{
+    cert_cb_calls++;
+    return 1;
+}
+
+/* Use certificate |cert| with key |key| in |ctx| or, if NULL, in |s| */
+static int use_cert(SSL_CTX *ctx, SSL *s, const char *cert, const char *key)
+{
+    X509 *x = load_cert(cert);
+    EVP_PKEY *pkey = load_key(key);
+    int ret = 0;
+
+    if (x != NULL && pkey != NULL)
+        ret = ctx != NULL
+              ? SSL_CTX_use_certificate(ctx, x)
+                && SSL_CTX_use_PrivateKey(ctx, pkey)
+              : SSL_use_certificate(s, x) && SSL_use_PrivateKey(s, pkey);
+    X509_free(x);
+    EVP_PKEY_free(pkey);
+    return ret;
+}
+
+/* Connect: the server must use |cert| and call the callback |cb| times */
+static int cert_handshake(SSL *sssl, SSL *cssl, X509 *cert, int cb)
+{
+    X509 *peer;
+    int ret;
+
+    cert_cb_calls = 0;
+    if (!create_ssl_connection(sssl, cssl))
+        return 0;
+    peer = SSL_get_peer_certificate(cssl);
+    ret = peer != NULL && X509_cmp(peer, cert) == 0 && cert_cb_calls == cb;
+    X509_free(peer);
+    if (!ret)
+        fprintf(stderr, "Wrong certificate or callback calls (%d)\n",
+                cert_cb_calls);
+    return ret;
+}
+
+static int test_ssl_ctx_changes_isolated(void)
+{
+    SSL_CTX *sctx = NULL, *cctx = NULL;
+    SSL *sssl = NULL, *cssl = NULL, *snew = NULL, *cnew = NULL;
+    X509 *ee = NULL, *ca = NULL;
+    int level, testresult = 1;
+
+    if (!create_ssl_ctxs(&sctx, &cctx)
+        || (ee = load_cert("ee-cert.pem")) == NULL
+        || (ca = load_cert("ca-cert.pem")) == NULL
+        || !create_ssl_objects(sctx, cctx, &sssl, &cssl))
+        goto end;
+    level = SSL_get_security_level(sssl);
+
+    /*
+     * SSL_CTX changes after SSL_new() do not reach the SSL. Level 5 needs
+     * keys far larger than the test keys, so had it reached the SSL the
+     * handshake would fail.
+     */
+    SSL_CTX_set_security_level(sctx, 5);
+    SSL_CTX_set_cert_cb(sctx, count_cert_cb, NULL);
+    if (SSL_get_security_level(sssl) != level) {
+        fprintf(stderr, "SSL_CTX change reached an existing SSL\n");
+        goto end;
+    }
+    /* The CA key is too small for level 5 as well */
+    SSL_CTX_set_security_level(sctx, level);
+    if (!use_cert(sctx, NULL, "ca-cert.pem", "ca-key.pem"))
+        goto end;
+    SSL_CTX_set_security_level(sctx, 5);
+    if (SSL_get_security_level(sssl) != level
+        || X509_cmp(SSL_get_certificate(sssl), ee) != 0) {
+        fprintf(stderr, "SSL_CTX change reached an existing SSL\n");
+        goto end;
+    }
+    if (!cert_handshake(sssl, cssl, ee, 0))
+        goto end;
+
+    /* New SSL objects do get them */
+    SSL_free(sssl);
+    SSL_free(cssl);
+    sssl = cssl = NULL;
+    if (!create_ssl_objects(sctx, cctx, &sssl, &cssl)
+        || !create_ssl_objects(sctx, cctx, &snew, &cnew))
+        goto end;
+    if (SSL_get_security_level(sssl) != 5
+        || X509_cmp(SSL_get_certificate(sssl), ca) != 0) {
+        fprintf(stderr, "SSL_CTX change did not reach a new SSL\n");
+        goto end;
+    }
+
+    /*
+     * SSL changes do not reach the SSL_CTX, nor another SSL made from it
+     */
+    SSL_set_security_level(sssl, level);
+    SSL_set_cert_cb(sssl, NULL, NULL);
+    if (!use_cert(NULL, sssl, "ee-cert.pem", "ee-key.pem"))
+        goto end;
+    if (SSL_CTX_get_security_level(sctx) != 5
+        || SSL_get_security_level(snew) != 5
+        || X509_cmp(SSL_CTX_get0_certificate(sctx), ca) != 0
+        || X509_cmp(SSL_get_certificate(snew), ca) != 0) {
+        fprintf(stderr, "SSL change reached its SSL_CTX\n");
+        goto end;
+    }
+    if (!cert_handshake(sssl, cssl, ee, 0))
+        goto end;
+    SSL_set_security_level(snew, level);
+    if (SSL_CTX_get_security_level(sctx) != 5
+        || !cert_handshake(snew, cnew, ca, 1))
+        goto end;
+
+    testresult = 0;
+ end:
+    SSL_free(sssl);
+    SSL_free(cssl);
+    SSL_free(snew);
+    SSL_free(cnew);
+    X509_free(ee);
+    X509_free(ca);
+    SSL_CTX_free(sctx);
+    SSL_CTX_free(cctx);
+    return testresult;
+}
+
+/*
+ * Which custom extensions were sent and received is per connection, while
+ * the extensions are configured on the shared SSL_CTX: two handshakes
+ * interleaved on the same SSL_CTXs must each see their own.
+ */
+
+#define TEST_EXT_TYPE   1000
+
+static int ext_parsed[2];
+
+static int test_ext_add_cb(SSL *s, unsigned int ext_type,
+                           const unsigned char **out, size_t *outlen, int *al,
+                           void *arg)
+{
+    static const unsigned char data[] = { 1, 2, 3 };
+
+    *out = data;
+    *outlen = sizeof(data);
+    return 1;
+}
+
+static int test_ext_parse_cb(SSL *s, unsigned int ext_type,
+                             const unsigned char *in, size_t inlen, int *al,
+                             void *arg)
+{
+    ext_parsed[*(int *)arg]++;
+    return inlen == 3 && in[2] == 3;
+}
+
+static int test_custom_ext_per_connection(void)
+{
+    static int server = 0, client = 1;
+    SSL_CTX *sctx = NULL, *cctx = NULL;
+    SSL *sssl1 = NULL, *cssl1 = NULL, *sssl2 = NULL, *cssl2 = NULL;
+    int testresult = 1;
+
+    ext_parsed[0] = ext_parsed[1] = 0;
+    if (!create_ssl_ctxs(&sctx, &cctx)
+        || !SSL_CTX_add_server_custom_ext(sctx, TEST_EXT_TYPE,
+                                          test_ext_add_cb, NULL, NULL,
+                                          test_ext_parse_cb, &server)
+        || !SSL_CTX_add_client_custom_ext(cctx, TEST_EXT_TYPE,
+                                          test_ext_add_cb, NULL, NULL,
+                                          test_ext_parse_cb, &client)
+        || !create_ssl_objects(sctx, cctx, &sssl1, &cssl1)
+        || !create_ssl_objects(sctx, cctx, &sssl2, &cssl2))
+        goto end;
+
+    /* Both ClientHellos go out before either ServerHello comes back */
+    if (SSL_do_handshake(cssl1) > 0 || SSL_do_handshake(cssl2) > 0
+        || !create_ssl_connection(sssl1, cssl1)
+        || !create_ssl_connection(sssl2, cssl2))
+        goto end;
+    if (ext_parsed[0] != 2 || ext_parsed[1] != 2) {
+        fprintf(stderr, "Extension parsed %d times by servers, %d by "
+                "clients\n", ext_parsed[0], ext_parsed[1]);
+        goto end;
+    }
+
+    testresult = 0;
+ end:
+    SSL_free(sssl1);
+    SSL_free(cssl1);
+    SSL_free(sssl2);
+    SSL_free(cssl2);
+    SSL_CTX_free(sctx);
+    SSL_CTX_free(cctx);
+    return testresult;
+}
+
+/*
+ * Session tickets under the built in keys. A handshake resumes |sess| if
+ * given, and the session it ends with is returned in |*newsess|.
+ */
+static int ticket_handshake(SSL_CTX *sctx, SSL_CTX *cctx, SSL_SESSION *sess,
+                            SSL_SESSION **newsess, int *reused)
+{
+    SSL *sssl = NULL, *cssl = NULL;
+    int ret = 0;
+
+    if (!create_ssl_objects(sctx, cctx, &sssl, &cssl)
+        || (sess != NULL && !SSL_set_session(cssl, sess))
+        || !create_ssl_connection(sssl, cssl))
+        goto end;
+    *reused = SSL_session_reused(cssl);
+    *newsess = SSL_get1_session(cssl);
+    ret = *newsess != NULL;
+ end:
+    SSL_free(sssl);
+    SSL_free(cssl);
+    return ret;
+}
+
+/* Whether |sess| holds a ticket encrypted under the key named |name| */
+static int ticket_key_is(SSL_SESSION *sess, const unsigned char *name)
+{
+    unsigned char *tick;
+    size_t len;
+
+    SSL_SESSION_get0_ticket(sess, &tick, &len);
+    return len >= 16 && memcmp(tick, name, 16) == 0;
+}
+
+static void make_ticket_keys(unsigned char keys[48], unsigned char c)
+{
+    size_t i;
+
+    for (i = 0; i < 48; i++)
+        keys[i] = (unsigned char)(c + i);
+}
+
+/*
+ * Setting the ticket keys takes effect at once: they are read back, new
+ * tickets are encrypted under them and tickets under the old key no longer
+ * resume a session.
+ */
+static int test_ticket_keys(void)
+{
+    SSL_CTX *sctx = NULL, *cctx = NULL;
+    SSL_SESSION *sess1 = NULL, *sess2 = NULL, *sess3 = NULL;
+    unsigned char keys1[48], keys2[48], got[48];
+    int reused, testresult = 1;
+
+    make_ticket_keys(keys1, 0x10);
+    make_ticket_keys(keys2, 0x80);
+    if (!create_ssl_ctxs(&sctx, &cctx))
+        goto end;
+    SSL_CTX_set_session_cache_mode(sctx, SSL_SESS_CACHE_OFF);
+
+    if (SSL_CTX_set_tlsext_ticket_keys(sctx, NULL, 0) != 48
+        || SSL_CTX_set_tlsext_ticket_keys(sctx, keys1, 47)
+        || !SSL_CTX_set_tlsext_ticket_keys(sctx, keys1, sizeof(keys1))
+        || !SSL_CTX_get_tlsext_ticket_keys(sctx, got, sizeof(got))
+        || memcmp(got, keys1, sizeof(got)) != 0) {
+        fprintf(stderr, "Setting the ticket keys failed\n");
+        goto end;
+    }
+
+    if (!ticket_handshake(sctx, cctx, NULL, &sess1, &reused)
+        || reused || !ticket_key_is(sess1, keys1)) {
+        fprintf(stderr, "No ticket under the first key\n");
+        goto end;
+    }
+    if (!ticket_handshake(sctx, cctx, sess1, &sess2, &reused) || !reused) {
+        fprintf(stderr, "Ticket under the first key did not resume\n");
+        goto end;
+    }
+
+    if (!SSL_CTX_set_tlsext_ticket_keys(sctx, keys2, sizeof(keys2))
+        || !SSL_CTX_get_tlsext_ticket_keys(sctx, got, sizeof(got))
+        || memcmp(got, keys2, sizeof(got)) != 0) {
+        fprintf(stderr, "Replacing the ticket keys failed\n");
+        goto end;
+    }
+    if (!ticket_handshake(sctx, cctx, sess1, &sess3, &reused)
+        || reused || !ticket_key_is(sess3, keys2)) {
+        fprintf(stderr, "Ticket under a replaced key was accepted\n");
+        goto end;
+    }
+
+    testresult = 0;
+ end:
+    SSL_SESSION_free(sess1);
+    SSL_SESSION_free(sess2);
+    SSL_SESSION_free(sess3);
+    SSL_CTX_free(sctx);
+    SSL_CTX_free(cctx);
+    return testresult;
+}
+
+/*
+ * Rotating the built in ticket keys: a ticket under an older key still
+ * resumes and is renewed under the newest key, until the key falls off the
+ * ring, after which it no longer resumes.
+ */
+static int test_ticket_key_rotation(void)
+{
+    SSL_CTX *sctx = NULL, *cctx = NULL;
+    SSL_SESSION *sess[5] = { NULL, NULL, NULL, NULL, NULL };
+    unsigned char keys[4][48];
+    int i, reused, testresult = 1;
+
+    for (i = 0; i < 4; i++)
+        make_ticket_keys(keys[i], (unsigned char)(0x20 + 0x30 * i));
+    if (!create_ssl_ctxs(&sctx, &cctx))
+        goto end;
+    SSL_CTX_set_session_cache_mode(sctx, SSL_SESS_CACHE_OFF);
+
+    if (SSL_CTX_rotate_tlsext_ticket_key(sctx, keys[0], 47)
+        || SSL_CTX_set_tlsext_ticket_key_ring_size(sctx, 0)
+        || SSL_CTX_set_tlsext_ticket_key_ring_size(sctx, 17)) {
+        fprintf(stderr, "Bad ticket key arguments were accepted\n");
+        goto end;
+    }
+    ERR_clear_error();
+
+    /* The default ring of 2 keys: one rotation keeps a ticket valid */
+    if (!SSL_CTX_rotate_tlsext_ticket_key(sctx, keys[0], sizeof(keys[0]))
+        || !ticket_handshake(sctx, cctx, NULL, &sess[0], &reused)
+        || !ticket_key_is(sess[0], keys[0])
+        || !SSL_CTX_rotate_tlsext_ticket_key(sctx, keys[1], sizeof(keys[1]))
+        || !ticket_handshake(sctx, cctx, sess[0], &sess[1], &reused)
+        || !reused || !ticket_key_is(sess[1], keys[1])) {
+        fprintf(stderr, "Ticket under the previous key was not renewed\n");
+        goto end;
+    }
+    /* The second rotation drops the first key */
+    if (!SSL_CTX_rotate_tlsext_ticket_key(sctx, keys[2], sizeof(keys[2]))
+        || !ticket_handshake(sctx, cctx, sess[0], &sess[2], &reused)
+        || reused || !ticket_key_is(sess[2], keys[2])) {
+        fprintf(stderr, "Ticket under a dropped key was accepted\n");
+        goto end;
+    }
+
+    /* With room for 3 keys a ticket survives two rotations */
+    if (!SSL_CTX_set_tlsext_ticket_key_ring_size(sctx, 3)
+        || !SSL_CTX_rotate_tlsext_ticket_key(sctx, keys[3], sizeof(keys[3]))
+        || !ticket_handshake(sctx, cctx, sess[1], &sess[3], &reused)
+        || !reused || !ticket_key_is(sess[3], keys[3])) {
+        fprintf(stderr, "Ticket two rotations old was not renewed\n");
+        goto end;
+    }
+
+    /* Shrinking the ring drops the older keys at once */
+    if (!SSL_CTX_set_tlsext_ticket_key_ring_size(sctx, 1)
+        || !ticket_handshake(sctx, cctx, sess[2], &sess[4], &reused)
+        || reused) {
+        fprintf(stderr, "Ticket under a dropped key was accepted\n");
+        goto end;
+    }
+
+    testresult = 0;
+ end:
+    for (i = 0; i < 5; i++)
+        SSL_SESSION_free(sess[i]);
+    SSL_CTX_free(sctx);
+    SSL_CTX_free(cctx);
+    return testresult;
+}
+
+/* Count the application data records written */
+static int app_records_written;
+
+static void count_records_cb(int write_p, int version, int content_type,
+                             const void *buf, size_t len, SSL *s, void *arg)
+{
+    if (write_p && content_type == SSL3_RT_HEADER && len > 0
+        && ((const unsigned char *)buf)[0] == SSL3_RT_APPLICATION_DATA)
+        app_records_written++;
+}
+
+#ifndef OPENSSL_NO_ENGINE
+/*
+ * Record pipelining with the pipelined AES ciphers of the dasync engine.
+ * Every write is split over |PIPE_RECORDS| records, which are encrypted
+ * together, and the peer decrypts them together from its read buffer.
+ */
+# define PIPE_FRAGMENT  1024
+# define PIPE_RECORDS   4
+# define PIPE_ROUNDS    32
+
+/* Send |PIPE_ROUNDS| pipelined writes from |from| and check what |to| reads */
+static int pipeline_transfer(SSL *from, SSL *to)
+{
+    unsigned char out[PIPE_FRAGMENT * PIPE_RECORDS];
+    unsigned char in[sizeof(out)];
+    size_t i;
+    int r, got, ret;
+
+    SSL_set_msg_callback(from, count_records_cb);
+    for (r = 0; r < PIPE_ROUNDS; r++) {
+        for (i = 0; i < sizeof(out); i++)
+            out[i] = (unsigned char)(i * 7 + r);
+        app_records_written = 0;
+        if (SSL_write(from, out, sizeof(out)) != (int)sizeof(out)) {
+            fprintf(stderr, "Pipelined write failed\n");
+            return 0;
+        }
+        if (app_records_written != PIPE_RECORDS) {
+            fprintf(stderr, "Write was sent in %d records, expected %d\n",
+                    app_records_written, PIPE_RECORDS);
+            return 0;
+        }
+        for (got = 0; got < (int)sizeof(in); got += ret) {
+            ret = SSL_read(to, in + got, sizeof(in) - got);
+            if (ret <= 0) {
+                fprintf(stderr, "Pipelined read failed\n");
+                return 0;
+            }
+        }
+        if (memcmp(in, out, sizeof(in)) != 0) {
+            fprintf(stderr, "Pipelined data differs\n");
+            return 0;
+        }
+    }
+    SSL_set_msg_callback(from, NULL);
+    return 1;
+}
+
+static int test_dasync_pipelining(void)
+{
+    SSL_CTX *sctx = NULL, *cctx = NULL;
+    SSL *sssl = NULL, *cssl = NULL;
+    ENGINE *e;
+    int testresult = 1;
+
+#ifndef OPENSSL_NO_STATIC_ENGINE
+    ENGINE_load_dasync();
+#else
+    ENGINE_load_builtin_engines();
+#endif
+    e = ENGINE_by_id("dasync");
+    if (e == NULL) {
+        fprintf(stderr, "dasync engine not available, skipping\n");
+        ERR_clear_error();
+        return 0;
+    }
+    if (!ENGINE_init(e)) {
+        ENGINE_free(e);
+        return 1;
+    }
+    if (!ENGINE_set_default_ciphers(e)
+        || !create_ssl_ctxs(&sctx, &cctx)
+        || !SSL_CTX_set_cipher_list(sctx, "AES128-SHA")
+        || !SSL_CTX_set_cipher_list(cctx, "AES128-SHA")
+        || !SSL_CTX_set_max_pipelines(sctx, PIPE_RECORDS)
+        || !SSL_CTX_set_max_pipelines(cctx, PIPE_RECORDS)
+        || !SSL_CTX_set_split_send_fragment(sctx, PIPE_FRAGMENT)
+        || !SSL_CTX_set_split_send_fragment(cctx, PIPE_FRAGMENT)
+        || !create_ssl_objects(sctx, cctx, &sssl, &cssl)
+        || !create_ssl_connection(sssl, cssl))
+        goto end;
+
+    if (!pipeline_transfer(cssl, sssl) || !pipeline_transfer(sssl, cssl))
+        goto end;
+
+    testresult = 0;
+ end:
+    SSL_free(sssl);
+    SSL_free(cssl);
+    SSL_CTX_free(sctx);
+    SSL_CTX_free(cctx);
+    ENGINE_unregister_ciphers(e);
+    ENGINE_finish(e);
+    ENGINE_free(e);
+    return testresult;
+}
+#endif
+
+/*
+ * SSL_writev() against SSL_write(): the same data split over several
+ * buffers goes out in the same records, with the same partial writes and
+ * after the same retries, whether or not partial writes are enabled.
+ */
+#define WRITEV_LEN      40000
+
+static const size_t writev_pieces[] = { 1, 700, 0, 16384, 3000 };
+#define WRITEV_PIECES   (sizeof(writev_pieces) / sizeof(writev_pieces[0]))
+
+/* Point |iov| at what is left of |data| after |off| bytes, in pieces */
+static int writev_iov(SSL_IOVEC *iov, const unsigned char *data, size_t off)
+{
+    size_t i, start = 0, end, n = 0;
+
+    for (i = 0; i <= WRITEV_PIECES; i++) {
+        end = i < WRITEV_PIECES ? start + writev_pieces[i]
+                                            : WRITEV_LEN;
+        if (end > off || (end == start && start >= off)) {
+            iov[n].buf = data + (start > off ? start : off);
+            iov[n].len = end - (start > off ? start : off);
+            n++;
+        }
+        start = end;
+    }
+    return (int)n;
+}
+
+/*
+ * Send |data| from |cssl| to |sssl|, with SSL_writev() if |usev| is set.
+ * The results of the writes are recorded in |rets|, -1 for a retry.
+ */
+static int writev_transfer(SSL *cssl, SSL *sssl, int usev,
+                           const unsigned char *data, unsigned char *got,
+                           int *rets, int *nrets)
+{
+    SSL_IOVEC iov[WRITEV_PIECES + 1];
+    size_t off = 0, rd = 0;
+    int ret, iovcnt = 0, retry = 0;
+
+    *nrets = 0;
+    while (off < WRITEV_LEN || rd < WRITEV_LEN) {
+        if (off < WRITEV_LEN) {
+            /* A retry must repeat the call with the same arguments */
+            if (!retry)
+                iovcnt = writev_iov(iov, data, off);
+            if (usev)
+                ret = SSL_writev(cssl, iov, iovcnt);
+            else
+                ret = SSL_write(cssl, data + off, (int)(WRITEV_LEN - off));
+            if (*nrets == 64)
+                return 0;
+            if (ret > 0) {
+                off += ret;
+                retry = 0;
+                rets[(*nrets)++] = ret;
+                /* Let the writes fill the BIO pair until one has to wait */
+                if (off < WRITEV_LEN)
+                    continue;
+            } else if (SSL_get_error(cssl, ret) == SSL_ERROR_WANT_WRITE) {
+                retry = 1;
+                rets[(*nrets)++] = -1;
+            } else {
+                return 0;
+            }
+        }
+        while (rd < WRITEV_LEN) {
+            ret = SSL_read(sssl, got + rd, (int)(WRITEV_LEN - rd));
+            if (ret <= 0) {
+                if (SSL_get_error(sssl, ret) != SSL_ERROR_WANT_READ)
+                    return 0;
+                break;
+            }
+            rd += ret;
+        }
+    }
+    return 1;
+}
+
+static int test_writev(void)
+{
+    SSL_CTX *sctx = NULL, *cctx = NULL;
+    SSL *sssl = NULL, *cssl = NULL;
+    unsigned char *data = NULL, *got = NULL;
+    int rets[2][64], nrets[2], records[2];
+    int i, mode, usev, retries, testresult = 1;
+
+    data = OPENSSL_malloc(WRITEV_LEN);
+    got = OPENSSL_malloc(WRITEV_LEN);
+    if (data == NULL || got == NULL || !create_ssl_ctxs(&sctx, &cctx))
+        goto end;
+    for (i = 0; i < WRITEV_LEN; i++)
+        data[i] = (unsigned char)(i % 251);
+
+    for (mode = 0; mode < 2; mode++) {
+        for (usev = 0; usev < 2; usev++) {
+            if (!create_ssl_objects(sctx, cctx, &sssl, &cssl)
+                || !create_ssl_connection(sssl, cssl))
+                goto end;
+            if (mode)
+                SSL_set_mode(cssl, SSL_MODE_ENABLE_PARTIAL_WRITE);
+            memset(got, 0, WRITEV_LEN);
+            app_records_written = 0;
+            SSL_set_msg_callback(cssl, count_records_cb);
+            if (!writev_transfer(cssl, sssl, usev, data, got, rets[usev],
+                                 &nrets[usev])
+                || memcmp(got, data, WRITEV_LEN) != 0) {
+                fprintf(stderr, "%s transfer failed\n",
+                        usev ? "SSL_writev" : "SSL_write");
+                goto end;
+            }
+            records[usev] = app_records_written;
+            SSL_free(sssl);
+            SSL_free(cssl);
+            sssl = cssl = NULL;
+        }
+        if (records[0] != records[1] || nrets[0] != nrets[1]
+            || memcmp(rets[0], rets[1], nrets[0] * sizeof(rets[0][0])) != 0) {
+            fprintf(stderr, "SSL_writev and SSL_write differ (mode %d): "
+                    "%d and %d records\n", mode, records[1], records[0]);
+            goto end;
+        }
+        /* Both retries and, if enabled, partial writes must have happened */
+        for (i = 0, retries = 0; i < nrets[0]; i++)
+            retries += rets[0][i] == -1;
+        if (retries == 0 || (nrets[0] - retries > 1) != mode) {
+            fprintf(stderr, "No retry or partial write (mode %d)\n", mode);
+            goto end;
+        }
+    }
+
+#ifndef OPENSSL_NO_DTLS
+    {
+        SSL_CTX *dctx = SSL_CTX_new(DTLS_client_method());
+        SSL *dssl = dctx != NULL ? SSL_new(dctx) : NULL;
+        SSL_IOVEC iov = { "x", 1 };
+        int ret = 0;
+
+        if (dssl != NULL) {
+            SSL_set_connect_state(dssl);
+            ret = SSL_writev(dssl, &iov, 1);
+        }
+        SSL_free(dssl);
+        SSL_CTX_free(dctx);
+        if (ret != -1
+            || ERR_GET_REASON(ERR_peek_error()) != SSL_R_UNSUPPORTED_PROTOCOL) {
+            fprintf(stderr, "SSL_writev was not refused over DTLS\n");
+            goto end;
+        }
+        ERR_clear_error();
+    }
+#endif
+
+    testresult = 0;
+ end:
+    SSL_free(sssl);
+    SSL_free(cssl);
+    SSL_CTX_free(sctx);
+    SSL_CTX_free(cctx);
+    OPENSSL_free(data);
+    OPENSSL_free(got);
+    return testresult;
+}
+
+/*
+ * Write coalescing: small writes are held back until SSL_flush(),
+ * BIO_flush() on an SSL BIO, a read that has to wait for the peer or
+ * SSL_shutdown(), even a quiet one, sends them.
+ */
+#define COALESCE_WRITES 5
+#define COALESCE_LEN    100
+
+/* Make small writes to |cssl|, directly or through the SSL BIO |bio| */
+static int coalesce_write(SSL *cssl, BIO *bio, unsigned char *buf)
+{
+    int i, ret;
+
+    for (i = 0; i < COALESCE_WRITES; i++) {
+        memset(buf, 'a' + i, COALESCE_LEN);
+        if (bio != NULL)
+            ret = BIO_write(bio, buf, COALESCE_LEN);
+        else
+            ret = SSL_write(cssl, buf, COALESCE_LEN);
+        if (ret != COALESCE_LEN)
+            return 0;
+        buf += COALESCE_LEN;
+    }
+    return 1;
+}
+
+/* Whether the held writes of |sent| can be read on |sssl| */
+static int coalesce_check(SSL *sssl, const unsigned char *sent)
+{
+    unsigned char got[COALESCE_WRITES * COALESCE_LEN];
+    int n = 0, ret;
+
+    while (n < (int)sizeof(got)) {
+        ret = SSL_read(sssl, got + n, sizeof(got) - n);
+        if (ret <= 0)
+            return 0;
+        n += ret;
+    }
+    return memcmp(got, sent, sizeof(got)) == 0;
+}
+
+static int test_write_coalesce(void)
+{
+    SSL_CTX *sctx = NULL, *cctx = NULL;
+    SSL *sssl = NULL, *cssl = NULL;
+    BIO *bio = NULL;
+    unsigned char sent[COALESCE_WRITES * COALESCE_LEN], buf[1];
+    int testresult = 1;
+
+    if (!create_ssl_ctxs(&sctx, &cctx)
+        || !create_ssl_objects(sctx, cctx, &sssl, &cssl)
+        || !create_ssl_connection(sssl, cssl)
+        || !SSL_set_write_coalesce_size(cssl, 4096))
+        goto end;
+
+    if (!coalesce_write(cssl, NULL, sent)
+        || BIO_ctrl_pending(SSL_get_rbio(sssl)) != 0) {
+        fprintf(stderr, "Small writes were not held back\n");
+        goto end;
+    }
+    if (SSL_flush(cssl) != 1 || !coalesce_check(sssl, sent)) {
+        fprintf(stderr, "SSL_flush did not send the held writes\n");
+        goto end;
+    }
+
+    if ((bio = BIO_new(BIO_f_ssl())) == NULL)
+        goto end;
+    BIO_set_ssl(bio, cssl, BIO_NOCLOSE);
+    if (!coalesce_write(cssl, bio, sent)
+        || BIO_ctrl_pending(SSL_get_rbio(sssl)) != 0
+        || BIO_flush(bio) != 1 || !coalesce_check(sssl, sent)) {
+        fprintf(stderr, "BIO_flush did not send the held writes\n");
+        goto end;
+    }
+
+    if (!coalesce_write(cssl, NULL, sent)
+        || SSL_read(cssl, buf, sizeof(buf)) > 0
+        || !coalesce_check(sssl, sent)) {
+        fprintf(stderr, "Reading did not send the held writes\n");
+        goto end;
+    }
+
+    SSL_set_quiet_shutdown(cssl, 1);
+    if (!coalesce_write(cssl, NULL, sent)
+        || SSL_shutdown(cssl) != 1 || !coalesce_check(sssl, sent)) {
+        fprintf(stderr, "SSL_shutdown did not send the held writes\n");
+        goto end;
+    }
+
+    testresult = 0;
+ end:
+    /* The SSL BIO holds a reference to the SSL's BIO */
+    BIO_free_all(bio);
+    SSL_free(sssl);
+    SSL_free(cssl);
+    SSL_CTX_free(sctx);
+    SSL_CTX_free(cctx);
+    return testresult;
+}
+
+/*
+ * A read buffer larger than one record: with reading ahead, the first
+ * SSL_read() takes in everything the peer has sent, and SSL_has_pending()
+ * reports the records buffered beyond the one SSL_pending() covers.
+ */
+#define READBUF_RECORDS 32
+#define READBUF_RECLEN  1000
+#define READBUF_LEN     (64 * 1024)
+
+static int read_buffer_check(SSL_CTX *sctx, SSL_CTX *cctx, long buflen)
+{
+    SSL *sssl = NULL, *cssl = NULL;
+    unsigned char buf[READBUF_RECLEN];
+    size_t left;
+    int i, ret = 0;
+
+    if (!create_ssl_objects_bufsize(sctx, cctx, &sssl, &cssl, READBUF_LEN))
+        goto end;
+    SSL_set_read_ahead(sssl, 1);
+    if (!SSL_set_default_read_buffer_len(sssl, buflen)
+        || !create_ssl_connection(sssl, cssl))
+        goto end;
+    if (SSL_has_pending(sssl) || SSL_has_pending(cssl)) {
+        fprintf(stderr, "Data pending after the handshake\n");
+        goto end;
+    }
+
+    for (i = 0; i < READBUF_RECORDS; i++) {
+        memset(buf, i, sizeof(buf));
+        if (SSL_write(cssl, buf, sizeof(buf)) != (int)sizeof(buf))
+            goto end;
+    }
+    if (SSL_read(sssl, buf, sizeof(buf)) != (int)sizeof(buf)
+        || SSL_pending(sssl) != 0 || !SSL_has_pending(sssl)) {
+        fprintf(stderr, "Records read ahead not reported as pending\n");
+        goto end;
+    }
+    /* Only a large read buffer takes in all records at once */
+    left = BIO_ctrl_pending(SSL_get_rbio(sssl));
+    if ((buflen > 0) != (left == 0)) {
+        fprintf(stderr, "%lu bytes left in the BIO with a read buffer of "
+                "%ld\n", (unsigned long)left, buflen);
+        goto end;
+    }
+
+    for (i = 1; i < READBUF_RECORDS; i++) {
+        if (SSL_read(sssl, buf, sizeof(buf)) != (int)sizeof(buf)
+            || buf[0] != i || buf[sizeof(buf) - 1] != i)
+            goto end;
+    }
+    if (SSL_has_pending(sssl)) {
+        fprintf(stderr, "Data pending after everything was read\n");
+        goto end;
+    }
+
+    ret = 1;
+ end:
+    SSL_free(sssl);
+    SSL_free(cssl);
+    return ret;
+}
+
+static int test_read_buffer_len(void)
+{
+    SSL_CTX *sctx = NULL, *cctx = NULL;
+    int testresult = 1;
+
+    if (!create_ssl_ctxs(&sctx, &cctx))
+        goto end;
+    if (SSL_CTX_set_default_read_buffer_len(sctx, -1)
+        || SSL_CTX_set_default_read_buffer_len(sctx, 256 * 1024 + 1)) {
+        fprintf(stderr, "Bad read buffer length was accepted\n");
+        goto end;
+    }
+    if (!read_buffer_check(sctx, cctx, 0)
+        || !read_buffer_check(sctx, cctx, READBUF_LEN))
+        goto end;
+
+    testresult = 0;
+ end:
+    SSL_CTX_free(sctx);
+    SSL_CTX_free(cctx);
+    return testresult;
+}
+
+#ifdef OPENSSL_SYS_UNIX
+/*
+ * SSL_sendfile() without kernel TLS, as over a BIO pair: the file is read
+ * in parts of at most 64KB and written like SSL_write(), including retries
+ * when the BIO is full, and with SSL_MODE_ASYNC.
+ */
+# define SENDFILE_LEN   100000
+# define SENDFILE_OFF   1000
+
+static int sendfile_transfer(SSL *cssl, SSL *sssl, int fd,
+                             const unsigned char *data, unsigned char *got)
+{
+    size_t sent = 0, rd = 0;
+    ossl_ssize_t ret;
+    int retries = 0;
+
+    while (rd < SENDFILE_LEN) {
+        if (sent < SENDFILE_LEN) {
+            /* Same arguments on a retry */
+            ret = SSL_sendfile(cssl, fd, SENDFILE_OFF + sent,
+                               SENDFILE_LEN - sent, 0);
+            if (ret > 0) {
+                if (ret > 65536)
+                    return 0;
+                sent += ret;
+            } else if (SSL_get_error(cssl, (int)ret) == SSL_ERROR_WANT_WRITE) {
+                retries++;
+            } else {
+                return 0;
+            }
+        }
+        while (rd < SENDFILE_LEN) {
+            ret = SSL_read(sssl, got + rd, SENDFILE_LEN - rd);
+            if (ret <= 0) {
+                if (SSL_get_error(sssl, (int)ret) != SSL_ERROR_WANT_READ)
+                    return 0;
+                break;
+            }
+            rd += ret;
+        }
+    }
+    return retries > 0
+           && memcmp(got, data + SENDFILE_OFF, SENDFILE_LEN) == 0;
+}
+
+static int test_sendfile_fallback(void)
+{
+    SSL_CTX *sctx = NULL, *cctx = NULL;
+    SSL *sssl = NULL, *cssl = NULL;
+    FILE *f = NULL;
+    unsigned char *data = NULL, *got = NULL;
+    size_t flen = SENDFILE_OFF + SENDFILE_LEN;
+    int i, fd, async, testresult = 1;
+
+    data = OPENSSL_malloc(flen);
+    got = OPENSSL_malloc(SENDFILE_LEN);
+    if (data == NULL || got == NULL || (f = tmpfile()) == NULL)
+        goto end;
+    for (i = 0; i < (int)flen; i++)
+        data[i] = (unsigned char)(i % 253);
+    if (fwrite(data, 1, flen, f) != flen || fflush(f) != 0
+        || fseek(f, 0, SEEK_SET) != 0)
+        goto end;
+    fd = fileno(f);
+
+    if (!create_ssl_ctxs(&sctx, &cctx))
+        goto end;
+    for (async = 0; async < 2; async++) {
+        if (!create_ssl_objects(sctx, cctx, &sssl, &cssl)
+            || !create_ssl_connection(sssl, cssl))
+            goto end;
+        if (async) {
+            if (!ASYNC_init(1, 0, 0))
+                goto end;
+            SSL_set_mode(cssl, SSL_MODE_ASYNC);
+        }
+        memset(got, 0, SENDFILE_LEN);
+        if (!sendfile_transfer(cssl, sssl, fd, data, got)) {
+            fprintf(stderr, "SSL_sendfile transfer failed (async %d)\n",
+                    async);
+            goto end;
+        }
+        if (SSL_sendfile(cssl, fd, flen, 10, 0) != 0
+            || SSL_sendfile(cssl, fd, 0, 10, 1) != -1
+            || ftell(f) != 0) {
+            fprintf(stderr, "SSL_sendfile end of file or flags wrong\n");
+            goto end;
+        }
+        ERR_clear_error();
+        SSL_free(sssl);
+        SSL_free(cssl);
+        sssl = cssl = NULL;
+    }
+
+    testresult = 0;
+ end:
+    SSL_free(sssl);
+    SSL_free(cssl);
+    SSL_CTX_free(sctx);
+    SSL_CTX_free(cctx);
+    if (f != NULL)
+        fclose(f);
+    OPENSSL_free(data);
+    OPENSSL_free(got);
+    ASYNC_cleanup(1);
+    return testresult;
+}
+#endif
+
+/*
+ * SSL_client_hello_get0_ext() and SSL_client_hello_get1_extensions_present()
+ * from the servername and certificate callbacks must give back the
+ * extensions the client sent, in order. Outside ClientHello processing they
+ * return 0.
+ */
+#define CH_MAX_EXTS     64
+
+static unsigned char ch_msg[SSL3_RT_MAX_PLAIN_LENGTH];
+static size_t ch_msglen;
+static int ch_servername_ok, ch_cert_ok;
+
+static void client_hello_msg_cb(int write_p, int version, int content_type,
+                                const void *buf, size_t len, SSL *s,
+                                void *arg)
+{
+    if (write_p && content_type == SSL3_RT_HANDSHAKE && len > 0
+        && len <= sizeof(ch_msg)
+        && ((const unsigned char *)buf)[0] == SSL3_MT_CLIENT_HELLO) {
+        memcpy(ch_msg, buf, len);
+        ch_msglen = len;
+    }
+}
+
+/*
+ * Find the extensions in the ClientHello |ch_msg| as sent: their types, and
+ * their contents as offsets into |ch_msg|. Returns their number, or -1.
+ */
+static int client_hello_exts(int *types, size_t *offs, size_t *lens)
+{
+    size_t p = SSL3_HM_HEADER_LENGTH + 2 + SSL3_RANDOM_SIZE, end;
+    int num = 0;
+
+    if (p >= ch_msglen)
+        return -1;
+    p += 1 + ch_msg[p];                         /* session id */
+    if (p + 2 > ch_msglen)
+        return -1;
+    p += 2 + ((ch_msg[p] << 8) | ch_msg[p + 1]); /* cipher suites */
+    if (p >= ch_msglen)
+        return -1;
+    p += 1 + ch_msg[p];                         /* compression methods */
+    if (p == ch_msglen)
+        return 0;
+    if (p + 2 > ch_msglen)
+        return -1;
+    end = p + 2 + ((ch_msg[p] << 8) | ch_msg[p + 1]);
+    if (end != ch_msglen)
+        return -1;
+    for (p += 2; p < end; num++) {
+        if (num == CH_MAX_EXTS || p + 4 > end)
+            return -1;
+        types[num] = (ch_msg[p] << 8) | ch_msg[p + 1];
+        lens[num] = (ch_msg[p + 2] << 8) | ch_msg[p + 3];
+        offs[num] = p + 4;
+        p += 4 + lens[num];
+        if (p > end)
+            return -1;
+    }
+    return num;
+}
+
+static int client_hello_check(SSL *s)
+{
+    int types[CH_MAX_EXTS], *present = NULL;
+    size_t offs[CH_MAX_EXTS], lens[CH_MAX_EXTS], npresent, outlen;
+    const unsigned char *out;
+    int i, num, ret = 0;
+
+    if ((num = client_hello_exts(types, offs, lens)) <= 0
+        || !SSL_client_hello_get1_extensions_present(s, &present, &npresent)
+        || npresent != (size_t)num)
+        goto end;
+    for (i = 0; i < num; i++) {
+        if (present[i] != types[i]
+            || !SSL_client_hello_get0_ext(s, types[i], &out, &outlen)
+            || outlen != lens[i]
+            || (outlen > 0 && memcmp(out, ch_msg + offs[i], outlen) != 0))
+            goto end;
+    }
+    /* Not an extension anyone uses */
+    if (SSL_client_hello_get0_ext(s, 0xfeed, &out, &outlen))
+        goto end;
+    ret = 1;
+ end:
+    OPENSSL_free(present);
+    return ret;
+}
+
+static int client_hello_servername_cb(SSL *s, int *al, void *arg)
+{
+    ch_servername_ok = client_hello_check(s);
+    return SSL_TLSEXT_ERR_OK;
+}
+
+static int client_hello_cert_cb(SSL *s, void *arg)
+{
+    ch_cert_ok = client_hello_check(s);
+    return 1;
+}
+
+static int client_hello_not_available(SSL *s)
+{
+    int *present = NULL;
+    size_t len;
+    const unsigned char *out;
+
+    if (SSL_client_hello_get0_ext(s, TLSEXT_TYPE_server_name, &out, &len)
+        || SSL_client_hello_get1_extensions_present(s, &present, &len)) {
+        OPENSSL_free(present);
+        return 0;
+    }
+    return 1;
+}
+
+static int test_client_hello_exts(void)
+{
+    SSL_CTX *sctx = NULL, *cctx = NULL;
+    SSL *sssl = NULL, *cssl = NULL;
+    int testresult = 1;
+
+    if (!create_ssl_ctxs(&sctx, &cctx))
+        goto end;
+    SSL_CTX_set_tlsext_servername_callback(sctx, client_hello_servername_cb);
+    SSL_CTX_set_cert_cb(sctx, client_hello_cert_cb, NULL);
+
+    if (!create_ssl_objects(sctx, cctx, &sssl, &cssl)
+        || !SSL_set_tlsext_host_name(cssl, "server.example"))
+        goto end;
+    SSL_set_msg_callback(cssl, client_hello_msg_cb);
+    ch_msglen = 0;
+    ch_servername_ok = ch_cert_ok = 0;
+
+    if (!client_hello_not_available(sssl)
+        || !client_hello_not_available(cssl)) {
+        fprintf(stderr, "ClientHello extensions available before handshake\n");
+        goto end;
+    }
+    if (!create_ssl_connection(sssl, cssl))
+        goto end;
+    if (!ch_servername_ok || !ch_cert_ok) {
+        fprintf(stderr, "ClientHello extensions wrong in callback: "
+                "servername %d, cert %d\n", ch_servername_ok, ch_cert_ok);
+        goto end;
+    }
+    if (!client_hello_not_available(sssl)
+        || !client_hello_not_available(cssl)) {
+        fprintf(stderr, "ClientHello extensions available after handshake\n");
+        goto end;
+    }
+
+    testresult = 0;
+ end:
+    SSL_free(sssl);
+    SSL_free(cssl);
+    SSL_CTX_free(sctx);
+    SSL_CTX_free(cctx);
+    return testresult;
+}
+
+#ifndef OPENSSL_NO_KTLS
+/*
+ * With kernel TLS receiving, the kernel checks the records and only reports
+ * a bad one through errno. A BIO that claims kernel TLS and fails every read
+ * with a given errno stands in for the socket, and the alert the client
+ * sends must be the one for that error.
+ */
+static int ktls_errno;
+static int ktls_alert_sent;
+
+static int ktls_err_read(BIO *b, char *out, int outl)
+{
+    errno = ktls_errno;
+    return -1;
+}
+
+static int ktls_err_write(BIO *b, const char *in, int inl)
+{
+    return inl;
+}
+
+static long ktls_err_ctrl(BIO *b, int cmd, long num, void *ptr)
+{
+    switch (cmd) {
+    case BIO_CTRL_GET_KTLS_RECV:
+    case BIO_CTRL_FLUSH:
+        return 1;
+    default:
+        return 0;
+    }
+}
+
+static int ktls_err_new(BIO *b)
+{
+    b->init = 1;
+    return 1;
+}
+
+static BIO_METHOD ktls_err_method = {
+    BIO_TYPE_SOURCE_SINK,
+    "kernel TLS read error",
+    ktls_err_write,
+    ktls_err_read,
+    NULL,
+    NULL,
+    ktls_err_ctrl,
+    ktls_err_new,
+    NULL,
+    NULL
+};
+
+static void ktls_alert_cb(int write_p, int version, int content_type,
+                          const void *buf, size_t len, SSL *s, void *arg)
+{
+    if (write_p && content_type == SSL3_RT_ALERT && len == 2)
+        ktls_alert_sent = ((const unsigned char *)buf)[1];
+}
+
+static int ktls_read_error(SSL_CTX *sctx, SSL_CTX *cctx, int err, int alert,
+                           int reason)
+{
+    SSL *sssl = NULL, *cssl = NULL;
+    BIO *rbio, *wbio;
+    unsigned char buf[16];
+    unsigned long e;
+    int ret = 0;
+
+    if (!create_ssl_objects(sctx, cctx, &sssl, &cssl)
+        || !create_ssl_connection(sssl, cssl))
+        goto end;
+    /* Alerts go to |wbio|, and SSL_set_bio() frees the BIO pair end */
+    rbio = BIO_new(&ktls_err_method);
+    wbio = BIO_new(BIO_s_mem());
+    if (rbio == NULL || wbio == NULL) {
+        BIO_free(rbio);
+        BIO_free(wbio);
+        goto end;
+    }
+    SSL_set_bio(cssl, rbio, wbio);
+    SSL_set_msg_callback(cssl, ktls_alert_cb);
+
+    ktls_errno = err;
+    ktls_alert_sent = -1;
+    ERR_clear_error();
+    if (SSL_read(cssl, buf, sizeof(buf)) != -1
+        || SSL_get_error(cssl, -1) != SSL_ERROR_SSL) {
+        fprintf(stderr, "SSL_read did not fail for errno %d\n", err);
+        goto end;
+    }
+    e = ERR_peek_last_error();
+    if (ERR_GET_REASON(e) != reason || ktls_alert_sent != alert) {
+        fprintf(stderr, "errno %d: reason %d and alert %d, expected %d and "
+                "%d\n", err, ERR_GET_REASON(e), ktls_alert_sent, reason,
+                alert);
+        goto end;
+    }
+    ret = 1;
+ end:
+    ERR_clear_error();
+    SSL_free(sssl);
+    SSL_free(cssl);
+    return ret;
+}
+
+static int test_ktls_read_errors(void)
+{
+    SSL_CTX *sctx = NULL, *cctx = NULL;
+    int testresult = 1;
+
+    if (!create_ssl_ctxs(&sctx, &cctx)
+        || !ktls_read_error(sctx, cctx, EBADMSG, SSL_AD_BAD_RECORD_MAC,
+                            SSL_R_DECRYPTION_FAILED_OR_BAD_RECORD_MAC)
+        || !ktls_read_error(sctx, cctx, EMSGSIZE, SSL_AD_RECORD_OVERFLOW,
+                            SSL_R_PACKET_LENGTH_TOO_LONG))
+        goto end;
+
+    testresult = 0;
+ end:
+    SSL_CTX_free(sctx);
+    SSL_CTX_free(cctx);
+    return testresult;
+}
+#endif
+
+int main(int argc, char *argv[])
+{
+    int testresult;
+
+    if (argc != 2) {
+        fprintf(stderr, "usage: sslapitest certsdir\n");
+        return EXIT_FAILURE;
+    }
+    certsdir = argv[1];
+
+    SSL_library_init();
+    SSL_load_error_strings();
+
+    CRYPTO_set_mem_debug(1);
+    CRYPTO_mem_ctrl(CRYPTO_MEM_CHECK_ON);
+
+    ADD_TEST(test_ocsp_staple_cache);
+    ADD_TEST(test_ssl_ctx_changes_isolated);
+    ADD_TEST(test_custom_ext_per_connection);
+    ADD_TEST(test_ticket_keys);
+    ADD_TEST(test_ticket_key_rotation);
+#ifndef OPENSSL_NO_ENGINE
+    ADD_TEST(test_dasync_pipelining);
+#endif
+    ADD_TEST(test_writev);
+    ADD_TEST(test_write_coalesce);
+    ADD_TEST(test_read_buffer_len);
+#ifdef OPENSSL_SYS_UNIX
+    ADD_TEST(test_sendfile_fallback);
+#endif
+    ADD_TEST(test_client_hello_exts);
+#ifndef OPENSSL_NO_KTLS
+    ADD_TEST(test_ktls_read_errors);
+#endif
+
+    testresult = run_tests(argv[0]);
+
+    ERR_free_strings();
+    ERR_remove_thread_state(NULL);
+#ifndef OPENSSL_NO_ENGINE
+    ENGINE_cleanup();
+#endif
+    EVP_cleanup();
+    CRYPTO_cleanup_all_ex_data();
+#ifndef OPENSSL_NO_CRYPTO_MDEBUG
+    CRYPTO_mem_leaks_fp(stderr);
+#endif
+
+    return testresult;
+}
@@ -735,6 +735,9 @@ static const char rnd_seed[] =
 
 int doit_biopair(SSL *s_ssl, SSL *c_ssl, long bytes, clock_t *s_time,
                  clock_t *c_time);
+static int time_ssl_new(SSL_CTX *ctx, int n);
+static int count_allocs(SSL_CTX *s_ctx, SSL_CTX *c_ctx, int n);
+static void print_mem_cache_stats(void);
 int doit(SSL *s_ssl, SSL *c_ssl, long bytes);
 static int do_test_cipherlist(void);
 
@@ -755,6 +758,10 @@ static void sv_usage(void)
     fprintf(stderr, " -d            - debug output\n");
     fprintf(stderr, " -reuse        - use session-id reuse\n");
     fprintf(stderr, " -num <val>    - number of connections to perform\n");
+    fprintf(stderr,
+            " -new_free <val> - time <val> SSL_new()/SSL_free() pairs first\n");
+    fprintf(stderr,
+            " -allocs       - count allocations per handshake and per record\n");
     fprintf(stderr,
             " -bytes <val>  - number of bytes to swap between client/server\n");
 #ifndef OPENSSL_NO_DH
@@ -1023,7 +1030,7 @@ int main(int argc, char *argv[])
     SSL_CTX *c_ctx = NULL;
     const SSL_METHOD *meth = NULL;
     SSL *c_ssl, *s_ssl;
-    int number = 1, reuse = 0;
+    int number = 1, reuse = 0, new_free = 0, mem_cache = 0, allocs = 0;
     long bytes = 256L;
 #ifndef OPENSSL_NO_DH
     DH *dh;
@@ -1062,6 +1069,14 @@ int main(int argc, char *argv[])
     debug = 0;
     cipher = 0;
 
+    /* These must come before anything is allocated */
+    p = getenv("OPENSSL_MEM_CACHE");
+    if (p != NULL && strcmp(p, "on") == 0)
+        mem_cache = CRYPTO_set_mem_cache(1);
+    for (i = 1; i < argc; i++)
+        if (strcmp(argv[i], "-allocs") == 0)
+            allocs = CRYPTO_set_mem_counters(1);
+
     bio_err = BIO_new_fp(stderr, BIO_NOCLOSE | BIO_FP_TEXT);
 
     CRYPTO_set_locking_callback(lock_dbg_cb);
@@ -1192,6 +1207,12 @@ int main(int argc, char *argv[])
             number = atoi(*(++argv));
             if (number == 0)
                 number = 1;
+        } else if (strcmp(*argv, "-allocs") == 0) {
+            /* Already seen */
+        } else if (strcmp(*argv, "-new_free") == 0) {
+            if (--argc < 1)
+                goto bad;
+            new_free = atoi(*(++argv));
         } else if (strcmp(*argv, "-bytes") == 0) {
             if (--argc < 1)
                 goto bad;
@@ -1758,6 +1779,11 @@ int main(int argc, char *argv[])
         OPENSSL_free(alpn);
     }
 
+    if (new_free > 0 && !time_ssl_new(s_ctx, new_free))
+        goto end;
+    if (allocs && !count_allocs(s_ctx, c_ctx, number))
+        goto end;
+
     c_ssl = SSL_new(c_ctx);
     s_ssl = SSL_new(s_ctx);
 
@@ -1835,6 +1861,8 @@ int main(int argc, char *argv[])
     SSL_CONF_CTX_free(c_cctx);
     sk_OPENSSL_STRING_free(conf_args);
 
+    if (mem_cache)
+        print_mem_cache_stats();
     BIO_free(bio_stdout);
 
 #ifndef OPENSSL_NO_ENGINE
@@ -1852,6 +1880,132 @@ int main(int argc, char *argv[])
     EXIT(ret);
 }
 
+/*
+ * SSL_new() and SSL_free() on a configured context, as a server accepting
+ * many short connections does: measures the per-connection setup cost.
+ */
+static int time_ssl_new(SSL_CTX *ctx, int n)
+{
+    clock_t start = clock();
+    SSL *s;
+    int i;
+
+    for (i = 0; i < n; i++) {
+        if ((s = SSL_new(ctx)) == NULL) {
+            ERR_print_errors(bio_err);
+            return 0;
+        }
+        SSL_free(s);
+    }
+#ifdef CLOCKS_PER_SEC
+    BIO_printf(bio_stdout, "%d SSL_new/SSL_free pairs in %6.2f s\n", n,
+               (double)(clock() - start) / CLOCKS_PER_SEC);
+#else
+    BIO_printf(bio_stdout, "%d SSL_new/SSL_free pairs in %6.2f units\n", n,
+               (double)(clock() - start));
+#endif
+    return 1;
+}
+
+/* Run the handshake on a connected client and server to completion */
+static int handshake_pair(SSL *s_ssl, SSL *c_ssl)
+{
+    int i, s_ret = 0, c_ret = 0;
+
+    for (i = 0; i < 1000 && (s_ret <= 0 || c_ret <= 0); i++) {
+        if (c_ret <= 0 && (c_ret = SSL_do_handshake(c_ssl)) <= 0
+                && SSL_get_error(c_ssl, c_ret) != SSL_ERROR_WANT_READ)
+            return 0;
+        if (s_ret <= 0 && (s_ret = SSL_do_handshake(s_ssl)) <= 0
+                && SSL_get_error(s_ssl, s_ret) != SSL_ERROR_WANT_READ)
+            return 0;
+    }
+    return s_ret > 0 && c_ret > 0;
+}
+
+static void print_allocs(const char *what, int n)
+{
+    unsigned long allocs, frees;
+    size_t bytes, peak;
+
+    CRYPTO_get_mem_counters(&allocs, &frees, &bytes, &peak);
+    BIO_printf(bio_stdout,
+               "%s: %lu allocations, %lu frees, %lu bytes, peak %lu bytes\n",
+               what, allocs / n, frees / n, (unsigned long)bytes / n,
+               (unsigned long)peak);
+}
+
+/*
+ * Count the allocations done by |n| handshakes, including SSL_new() and
+ * SSL_free() on both sides, and then by |n| records of 1024 bytes sent and
+ * received over one connection.
+ */
+static int count_allocs(SSL_CTX *s_ctx, SSL_CTX *c_ctx, int n)
+{
+    SSL *s_ssl = NULL, *c_ssl = NULL;
+    BIO *s_bio, *c_bio;
+    unsigned char buf[1024];
+    int i, ret = 0;
+
+    memset(buf, 'A', sizeof(buf));
+    CRYPTO_reset_mem_counters();
+    for (i = 0; i < n; i++) {
+        if ((s_ssl = SSL_new(s_ctx)) == NULL
+                || (c_ssl = SSL_new(c_ctx)) == NULL
+                || !BIO_new_bio_pair(&s_bio, 0, &c_bio, 0))
+            goto err;
+        SSL_set_bio(s_ssl, s_bio, s_bio);
+        SSL_set_bio(c_ssl, c_bio, c_bio);
+        SSL_set_accept_state(s_ssl);
+        SSL_set_connect_state(c_ssl);
+        if (!handshake_pair(s_ssl, c_ssl))
+            goto err;
+        if (i == n - 1)
+            break;
+        SSL_free(s_ssl);
+        SSL_free(c_ssl);
+        s_ssl = c_ssl = NULL;
+    }
+    /* The last pair is kept for the records, so its frees are not counted */
+    print_allocs("per handshake", n);
+
+    CRYPTO_reset_mem_counters();
+    for (i = 0; i < n; i++) {
+        if (SSL_write(c_ssl, buf, sizeof(buf)) != sizeof(buf)
+                || SSL_read(s_ssl, buf, sizeof(buf)) != sizeof(buf))
+            goto err;
+    }
+    print_allocs("per record", n);
+    ret = 1;
+
+ err:
+    if (!ret) {
+        BIO_printf(bio_err, "allocation count failed\n");
+        ERR_print_errors(bio_err);
+    }
+    SSL_free(s_ssl);
+    SSL_free(c_ssl);
+    return ret;
+}
+
+static void print_mem_cache_stats(void)
+{
+    size_t size;
+    unsigned long allocs, hits, frees;
+    int i;
+
+    BIO_printf(bio_stdout, "%6s %10s %10s %10s\n", "size", "allocs", "hits",
+               "frees");
+    for (i = 0; CRYPTO_get_mem_cache_stats(i, &size, &allocs, &hits, &frees);
+         i++) {
+        if (size == 0)
+            BIO_printf(bio_stdout, "%6s", "larger");
+        else
+            BIO_printf(bio_stdout, "%6lu", (unsigned long)size);
+        BIO_printf(bio_stdout, " %10lu %10lu %10lu\n", allocs, hits, frees);
+    }
+}
+
 int doit_biopair(SSL *s_ssl, SSL *c_ssl, long count,
                  clock_t *s_time, clock_t *c_time)
 {
@@ -0,0 +1,285 @@
+/* ====================================================================
+ * Copyright (c) 2016 The OpenSSL Project.  All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * 3. All advertising materials mentioning features or use of this
+ *    software must display the following acknowledgment:
+ *    "This product includes software developed by the OpenSSL Project
+ *    for use in the OpenSSL Toolkit. (http://www.openssl.org/)"
+ *
+ * 4. The names "OpenSSL Toolkit" and "OpenSSL Project" must not be used to
+ *    endorse or promote products derived from this software without
+ *    prior written permission. For written permission, please contact
+ *    openssl-core@openssl.org.
+ *
+ * 5. Products derived from this software may not be called "OpenSSL"
+ *    nor may "OpenSSL" appear in their names without prior written
+ *    permission of the OpenSSL Project.
+ *
+ * 6. Redistributions of any form whatsoever must retain the following
+ *    acknowledgment:
+ *    "This product includes software developed by the OpenSSL Project
+ *    for use in the OpenSSL Toolkit (http://www.openssl.org/)"
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE OpenSSL PROJECT ``AS IS'' AND ANY
+ * EXPRESSED OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE OpenSSL PROJECT OR
+ * ITS CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT
+ * NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ * ====================================================================
+ *
+ * This product includes cryptographic software written by Eric Young
+ * (eay@cryptsoft.com).  This product includes software written by Tim
+ * Hudson (tjh@cryptsoft.com).
+ *
+ */
+
+/*
+ * Checks the certificate data that is computed on first use rather than
+ * when a certificate is decoded: the SHA-1 fingerprint used by X509_cmp(),
+ * and the X509_NAME_hash() and X509_NAME_hash_old() values.
+ * A fingerprint that could not be computed must not be cached; an engine
+ * whose SHA-1 always fails stands in for the failure.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <openssl/crypto.h>
+#include <openssl/bio.h>
+#include <openssl/evp.h>
+#include <openssl/sha.h>
+#include <openssl/x509.h>
+#include <openssl/pem.h>
+#include <openssl/err.h>
+#ifndef OPENSSL_NO_ENGINE
+# include <openssl/engine.h>
+
+static EVP_MD *bad_sha1 = NULL;
+static int bad_nids[] = { NID_sha1 };
+
+static int bad_sha1_init(EVP_MD_CTX *ctx)
+{
+    return 0;
+}
+
+static int bad_digests(ENGINE *e, const EVP_MD **md, const int **nids,
+                       int nid)
+{
+    if (md == NULL) {
+        *nids = bad_nids;
+        return 1;
+    }
+    if (nid != NID_sha1) {
+        *md = NULL;
+        return 0;
+    }
+    *md = bad_sha1;
+    return 1;
+}
+
+/* An engine that is the default SHA-1 implementation and always fails */
+static ENGINE *bad_engine_new(void)
+{
+    ENGINE *e = ENGINE_new();
+
+    if ((bad_sha1 = EVP_MD_meth_new(NID_sha1, NID_sha1WithRSAEncryption))
+            == NULL
+        || !EVP_MD_meth_set_result_size(bad_sha1, SHA_DIGEST_LENGTH)
+        || !EVP_MD_meth_set_input_blocksize(bad_sha1, SHA_CBLOCK)
+        || !EVP_MD_meth_set_init(bad_sha1, bad_sha1_init)
+        || e == NULL
+        || !ENGINE_set_id(e, "badsha1")
+        || !ENGINE_set_name(e, "Failing SHA-1")
+        || !ENGINE_set_digests(e, bad_digests)
+        || !ENGINE_set_default_digests(e)) {
+        ENGINE_free(e);
+        return NULL;
+    }
+    return e;
+}
+
+static void bad_engine_free(ENGINE *e)
+{
+    ENGINE_unregister_digests(e);
+    ENGINE_free(e);
+    EVP_MD_meth_free(bad_sha1);
+    bad_sha1 = NULL;
+}
+#endif
+
+/* Read the first |n| certificates of |file| */
+static int load_certs(const char *file, X509 **certs, int n)
+{
+    BIO *bio = BIO_new_file(file, "r");
+    int i;
+
+    if (bio == NULL)
+        return 0;
+    for (i = 0; i < n; i++)
+        if ((certs[i] = PEM_read_bio_X509(bio, NULL, NULL, NULL)) == NULL)
+            break;
+    BIO_free(bio);
+    return i == n;
+}
+
+static int test_cert_cmp(const char *file)
+{
+    X509 *a[2] = { NULL, NULL }, *b[2] = { NULL, NULL };
+    int ret = 0;
+
+    /* Two copies of two different certificates */
+    if (!load_certs(file, a, 2) || !load_certs(file, b, 2))
+        goto err;
+
+    if (X509_cmp(b[0], b[0]) != 0 || X509_cmp(b[0], b[1]) == 0) {
+        fprintf(stderr, "certificates compared wrongly\n");
+        goto err;
+    }
+
+#ifndef OPENSSL_NO_ENGINE
+    {
+        /* a[0] cannot compute its fingerprint here */
+        ENGINE *e = bad_engine_new();
+
+        if (e == NULL)
+            goto err;
+        X509_cmp(a[0], b[0]);
+        bad_engine_free(e);
+        ERR_clear_error();
+    }
+#endif
+
+    /* ... but must once SHA-1 works again */
+    if (X509_cmp(a[0], b[0]) != 0 || X509_cmp(b[0], a[0]) != 0) {
+        fprintf(stderr, "failed fingerprint was cached\n");
+        goto err;
+    }
+    if (X509_cmp(a[1], b[1]) != 0 || X509_cmp(a[0], a[1]) == 0) {
+        fprintf(stderr, "copies compared wrongly\n");
+        goto err;
+    }
+    ret = 1;
+ err:
+    if (!ret)
+        ERR_print_errors_fp(stderr);
+    X509_free(a[0]);
+    X509_free(a[1]);
+    X509_free(b[0]);
+    X509_free(b[1]);
+    return ret;
+}
+
+/* Check the cached hashes of |name| against those of a fresh copy */
+static int check_name_hashes(X509_NAME *name, const char *what)
+{
+    X509_NAME *copy = X509_NAME_dup(name);
+    int ret = 1;
+
+    if (copy == NULL)
+        return 0;
+    if (X509_NAME_hash(name) != X509_NAME_hash(copy)
+        || X509_NAME_hash(name) != X509_NAME_hash(copy)) {
+        fprintf(stderr, "%s: X509_NAME_hash() mismatch\n", what);
+        ret = 0;
+    }
+#ifndef OPENSSL_NO_MD5
+    if (X509_NAME_hash_old(name) != X509_NAME_hash_old(copy)
+        || X509_NAME_hash_old(name) != X509_NAME_hash_old(copy)) {
+        fprintf(stderr, "%s: X509_NAME_hash_old() mismatch\n", what);
+        ret = 0;
+    }
+#endif
+    X509_NAME_free(copy);
+    return ret;
+}
+
+static int test_name_hash(const char *file)
+{
+    X509 *x[2] = { NULL, NULL };
+    X509_NAME *name = NULL;
+    unsigned long h;
+    int ret = 0;
+
+    if (!load_certs(file, x, 2))
+        goto err;
+    if (!check_name_hashes(X509_get_subject_name(x[0]), "subject")
+        || !check_name_hashes(X509_get_issuer_name(x[0]), "issuer"))
+        goto err;
+    if (X509_NAME_hash(X509_get_subject_name(x[0]))
+            == X509_NAME_hash(X509_get_subject_name(x[1]))) {
+        fprintf(stderr, "different names hash the same\n");
+        goto err;
+    }
+
+    /* A changed name must not keep the hashes of the old one */
+    if ((name = X509_NAME_dup(X509_get_subject_name(x[0]))) == NULL)
+        goto err;
+    h = X509_NAME_hash(name);
+#ifndef OPENSSL_NO_MD5
+    X509_NAME_hash_old(name);
+#endif
+    if (!X509_NAME_add_entry_by_txt(name, "CN", MBSTRING_ASC,
+                                    (unsigned char *)"extra", -1, -1, 0))
+        goto err;
+    if (!check_name_hashes(name, "modified"))
+        goto err;
+    if (X509_NAME_hash(name) == h) {
+        fprintf(stderr, "modified name kept its hash\n");
+        goto err;
+    }
+    ret = 1;
+ err:
+    if (!ret)
+        ERR_print_errors_fp(stderr);
+    X509_NAME_free(name);
+    X509_free(x[0]);
+    X509_free(x[1]);
+    return ret;
+}
+
+int main(int argc, char **argv)
+{
+    int ret = EXIT_SUCCESS;
+
+    if (argc != 2) {
+        fprintf(stderr, "usage: x509cachetest certs.pem\n");
+        return EXIT_FAILURE;
+    }
+
+    CRYPTO_set_mem_debug(1);
+    CRYPTO_mem_ctrl(CRYPTO_MEM_CHECK_ON);
+
+    ERR_load_crypto_strings();
+
+    if (!test_cert_cmp(argv[1]) || !test_name_hash(argv[1]))
+        ret = EXIT_FAILURE;
+
+#ifndef OPENSSL_NO_ENGINE
+    ENGINE_cleanup();
+#endif
+    CRYPTO_cleanup_all_ex_data();
+    ERR_remove_thread_state(NULL);
+    ERR_free_strings();
+#ifndef OPENSSL_NO_CRYPTO_MDEBUG
+    CRYPTO_mem_leaks_fp(stderr);
+#endif
+    return ret;
+}